@@ -1,7 +1,20 @@
 import subprocess
 import json
 
+try:
+    import romtrimmer  # módulo nativo (-DBUILD_PYTHON_MODULE=ON)
+except ImportError:
+    romtrimmer = None
+
 def analyze_rom(rom_path):
+    # In-process: sem subprocess e sem parsear texto localizado
+    if romtrimmer is not None:
+        report = romtrimmer.analyze(rom_path)
+        return {
+            'padding': f"0x{report['padding_byte']:02X}",
+            'new_size': report['trimmed_size'],
+        }
+
     result = subprocess.run(
         ["romtrimmer++", "-i", rom_path, "--analyze", "--verbose"],
         capture_output=True,
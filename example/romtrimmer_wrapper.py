@@ -4,15 +4,30 @@
 import subprocess
 import json
 import os
+import socket
 from pathlib import Path
 from typing import List, Dict, Any
 
+try:
+    import romtrimmer  # módulo nativo (-DBUILD_PYTHON_MODULE=ON)
+except ImportError:
+    romtrimmer = None
+
 class RomTrimmerWrapper:
     def __init__(self, binary_path: str = "romtrimmer++"):
         self.binary = binary_path
         
     def analyze_rom(self, rom_path: str) -> Dict[str, Any]:
         """Analisa uma ROM sem modificá-la."""
+        if romtrimmer is not None:
+            report = romtrimmer.analyze(rom_path)
+            return {
+                "file": rom_path,
+                "size": report["original_size"],
+                "trim_possible": report["has_padding"] and report["safe"],
+                "report": report
+            }
+
         cmd = [
             self.binary,
             "-i", rom_path,
@@ -67,6 +82,45 @@ class RomTrimmerWrapper:
         
         return results
 
+class RomTrimmerServiceClient:
+    """Cliente do modo residente (romtrimmer++ --serve SOCKET).
+
+    Uma conexão atende várias requisições; cada arquivo gera um registro
+    JSON assim que termina, e a requisição fecha com {"done": true}.
+    """
+
+    def __init__(self, socket_path: str):
+        self.sock = socket.socket(socket.AF_UNIX, socket.SOCK_STREAM)
+        self.sock.connect(socket_path)
+        self.stream = self.sock.makefile("rw", encoding="utf-8")
+
+    def request(self, op: str, paths: List[str]):
+        """Gera os registros por arquivo (ordem de conclusão)."""
+        for path in paths:
+            if "\t" in path or "\n" in path or "\r" in path:
+                raise ValueError(f"caminho com TAB/quebra de linha: {path!r}")
+        self.stream.write("\t".join([op, *paths]) + "\n")
+        self.stream.flush()
+        for line in self.stream:
+            record = json.loads(line)
+            if record.get("done"):
+                return
+            yield record
+
+    def analyze(self, paths: List[str]) -> List[Dict[str, Any]]:
+        return list(self.request("analyze", paths))
+
+    def trim(self, paths: List[str]) -> List[Dict[str, Any]]:
+        return list(self.request("trim", paths))
+
+    def verify(self, paths: List[str]) -> List[Dict[str, Any]]:
+        return list(self.request("verify", paths))
+
+    def close(self):
+        self.stream.write("quit\n")
+        self.stream.flush()
+        self.sock.close()
+
 if __name__ == "__main__":
     wrapper = RomTrimmerWrapper()
     
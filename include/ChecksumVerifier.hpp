@@ -1,9 +1,13 @@
 #pragma once
 #include <string>
 #include <vector>
+#include <cstddef>
 #include <cstdint>
 #include <array>
 
+// EVP_MD_CTX sem puxar os headers do OpenSSL para quem só inclui este
+struct evp_md_ctx_st;
+
 class ChecksumVerifier {
 public:
     enum class ChecksumType {
@@ -12,34 +16,85 @@ public:
         SHA1,
         SHA256
     };
-    
+
     struct ChecksumResult {
         bool valid = false;
         std::string expected;
         std::string actual;
         ChecksumType type;
     };
-    
+
+    // Resultado de um Stream: hex minúsculo, como nos DATs
+    struct Digests {
+        uint64_t size = 0;
+        uint32_t crc32 = 0;
+        std::string crc32Hex;
+        std::string md5;
+        std::string sha1;
+        std::string sha256;   // vazio se não foi pedido
+    };
+
+    /**
+     * @brief CRC32 + MD5 + SHA1 (+ SHA256) de uma vez, bloco a bloco.
+     *
+     * Os digests vão pelo EVP do OpenSSL (que usa SHA-NI quando a CPU
+     * tem); o CRC32 pelo crc32Update abaixo.
+     */
+    class Stream {
+    public:
+        explicit Stream(bool withSha256 = false);
+        ~Stream();
+        // Cópia continua do mesmo ponto (para testar finais diferentes)
+        Stream(const Stream& other);
+        Stream& operator=(const Stream&) = delete;
+
+        void update(const void* data, size_t length);
+        // count bytes iguais a value, sem buffer do tamanho do trecho:
+        // CRC32 por combinação, digests por um bloco constante reusado
+        void updateRun(uint8_t value, uint64_t count);
+        Digests finish();
+
+        uint32_t currentCrc32() const { return crc; }
+        uint64_t bytesHashed() const { return size; }
+
+    private:
+        uint32_t crc = 0;
+        uint64_t size = 0;
+        evp_md_ctx_st* md5 = nullptr;
+        evp_md_ctx_st* sha1 = nullptr;
+        evp_md_ctx_st* sha256 = nullptr;
+    };
+
     ChecksumVerifier() = default;
     ~ChecksumVerifier() = default;
-    
+
     // Calcular checksum
     std::string calculate(const std::string& data, ChecksumType type);
-    
+
     // Verificar contra valor esperado
-    ChecksumResult verify(const std::string& data, 
-                         const std::string& expected, 
+    ChecksumResult verify(const std::string& data,
+                         const std::string& expected,
                          ChecksumType type);
-    
-    // Verificar arquivo contra database conhecido
-    bool verifyAgainstDatabase(const std::string& filename, 
+
+    // Verificar arquivo contra o CRC32 que o nome traz ("Jogo [1A2B3C4D].gba")
+    bool verifyAgainstDatabase(const std::string& filename,
                               const std::string& data);
-    
+
+    // Mesma convenção do crc32() da zlib: começa em 0 e encadeia blocos.
+    // PCLMULQDQ quando a CPU tem, senão slice-by-16.
+    static uint32_t crc32Update(uint32_t crc, const void* data, size_t length);
+
+    // CRC32 de A+B a partir dos CRCs de A e de B (zlib crc32_combine)
+    static uint32_t crc32Combine(uint32_t crcA, uint32_t crcB, uint64_t lengthB);
+
+    // CRC32 de count bytes iguais a value, em O(log count)
+    static uint32_t crc32Run(uint8_t value, uint64_t count);
+
 private:
     std::array<uint8_t, 16> calculateMD5(const std::string& data);
     std::array<uint8_t, 20> calculateSHA1(const std::string& data);
     std::array<uint8_t, 32> calculateSHA256(const std::string& data);
     uint32_t calculateCRC32(const std::string& data);
-    
+
     std::string bytesToHex(const uint8_t* bytes, size_t length);
-};
\ No newline at end of file
+};
@@ -0,0 +1,107 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+struct ChunkOptions {
+    uint32_t averageSize = 8192;   // potência de 2; mínimo = /4, máximo = x8
+    size_t threads = 0;            // 0 = automático
+};
+
+// Economia dentro de um conjunto (ou da biblioteca inteira)
+struct ChunkSetStats {
+    std::string name;
+    size_t files = 0;
+    size_t chunks = 0;
+    size_t uniqueChunks = 0;
+    uint64_t bytes = 0;
+    uint64_t uniqueBytes = 0;
+
+    double ratio() const { return uniqueBytes ? static_cast<double>(bytes) / uniqueBytes : 1.0; }
+    uint64_t savedBytes() const { return bytes - uniqueBytes; }
+};
+
+struct ChunkReport {
+    size_t filesFailed = 0;
+    ChunkSetStats library;
+    std::vector<ChunkSetStats> sets;   // mais economia primeiro
+};
+
+/**
+ * @brief Índice de chunks definidos pelo conteúdo (FastCDC) de várias ROMs.
+ *
+ * Os cortes saem de um gear hash rolante com chunking normalizado (máscara
+ * mais difícil antes do tamanho médio, mais fácil depois), então um trecho
+ * inserido ou removido só muda os chunks ao redor e versões/regiões do
+ * mesmo jogo voltam a alinhar logo depois da diferença. Cada chunk é
+ * identificado pelo SHA1. Os arquivos são cortados em paralelo; a junção
+ * no índice segue a ordem de entrada, então o resultado é determinístico.
+ *
+ * Conjuntos agrupam pelo nome sem as tags No-Intro: "Jogo (USA)" e
+ * "Jogo (Europe) (Rev 1)" caem em "Jogo".
+ */
+class ChunkIndex {
+public:
+    explicit ChunkIndex(const ChunkOptions& options = ChunkOptions());
+
+    ChunkReport analyze(const std::vector<fs::path>& files);
+
+    // Tamanho do próximo chunk a partir de data (length se couber inteiro)
+    size_t cutPoint(const uint8_t* data, size_t length) const;
+
+    // Pack com cada chunk único uma vez + manifesto para remontar os
+    // arquivos analisados. Os nomes ficam relativos à raiz (diretório ou
+    // arquivo de entrada) que contém cada um; sem raízes, ao diretório
+    // comum a todos. Cada chunk relido confere com o SHA1 da análise.
+    // Lança std::runtime_error em falha (sem deixar pack parcial).
+    void writePack(const fs::path& packPath, const std::vector<fs::path>& roots = {}) const;
+
+    // Remonta os arquivos de um pack em outputDir, conferindo o SHA1 de
+    // cada chunk. Sem overwrite, um arquivo que já exista aborta antes de
+    // qualquer escrita.
+    static size_t unpack(const fs::path& packPath, const fs::path& outputDir,
+                         bool overwrite = false);
+
+    // Limites de ChunkOptions::averageSize (fora disso o valor é ajustado)
+    static constexpr uint32_t MIN_AVERAGE_SIZE = 256;
+    static constexpr uint32_t MAX_AVERAGE_SIZE = 1024 * 1024;
+
+    static std::string setName(const fs::path& file);
+
+private:
+    using Fingerprint = std::array<uint8_t, 20>;
+
+    struct FingerprintHash {
+        size_t operator()(const Fingerprint& fp) const {
+            size_t value;
+            std::memcpy(&value, fp.data(), sizeof(value));
+            return value;
+        }
+    };
+
+    struct IndexedFile {
+        fs::path path;
+        uint64_t size = 0;
+        std::vector<uint32_t> chunks;   // ids em chunkLengths/chunkPrints
+    };
+
+    uint32_t minSize;
+    uint32_t averageSize;
+    uint32_t maxSize;
+    uint64_t smallMask;   // antes do tamanho médio: mais bits, corte mais raro
+    uint64_t largeMask;   // depois: menos bits
+    size_t threads;
+
+    std::vector<IndexedFile> files;
+    std::vector<uint32_t> chunkLengths;
+    std::vector<Fingerprint> chunkPrints;
+    std::unordered_map<Fingerprint, uint32_t, FingerprintHash> chunkIds;
+};
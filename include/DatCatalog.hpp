@@ -0,0 +1,131 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "ChecksumVerifier.hpp"
+#include "DatIntegration.hpp"
+
+// Status de verificação (o RomEntry::status em texto)
+enum class RomStatus : uint8_t {
+    NONE,
+    OK,
+    TRIMMED,
+    MISSING,
+    MODIFIED,
+    ONLY_IN_FIRST,
+    ONLY_IN_SECOND
+};
+
+const char* romStatusName(RomStatus status);
+RomStatus parseRomStatus(std::string_view text);
+
+// O que mudou entre duas entradas (bitmask de DatDifference::changes)
+enum DatChange : uint8_t {
+    DAT_ONLY_IN_FIRST  = 1 << 0,
+    DAT_ONLY_IN_SECOND = 1 << 1,
+    DAT_SIZE_CHANGED   = 1 << 2,
+    DAT_CRC32_CHANGED  = 1 << 3,
+    DAT_MD5_CHANGED    = 1 << 4,
+    DAT_SHA1_CHANGED   = 1 << 5,
+    DAT_RENAMED        = 1 << 6    // mesmo conteúdo, nome diferente
+};
+
+// Par de posições (NONE do lado que não tem a entrada) + o que mudou
+struct DatDifference {
+    static constexpr uint32_t NONE = UINT32_MAX;
+    uint32_t first = NONE;
+    uint32_t second = NONE;
+    uint8_t changes = 0;
+};
+
+/**
+ * @brief DAT em colunas: nomes numa arena, tamanho numérico, digests binários.
+ *
+ * Uma entrada custa ~66 bytes com os índices + o nome, sem alocação própria (um RomEntry
+ * são cinco std::string). Comparações são de inteiros/bytes, sem passar
+ * hex para minúsculas. RomEntry continua disponível via entry(i) para o
+ * código que ainda trabalha com ele.
+ */
+class DatCatalog {
+public:
+    using Md5 = std::array<uint8_t, 16>;
+    using Sha1 = std::array<uint8_t, 20>;
+
+    static constexpr size_t npos = static_cast<size_t>(-1);
+
+    DatCatalog() = default;
+
+    // Lê o DAT entrada a entrada, sem montar o vector<RomEntry>
+    static DatCatalog load(const std::string& datPath);
+    static DatCatalog fromEntries(const std::vector<RomEntry>& entries);
+
+    void add(const RomEntry& entry);
+    void reserve(size_t count);
+
+    size_t size() const { return sizes.size(); }
+    bool empty() const { return sizes.empty(); }
+
+    std::string_view name(size_t i) const {
+        return std::string_view(names).substr(nameOffsets[i], nameOffsets[i + 1] - nameOffsets[i]);
+    }
+    bool hasSize(size_t i) const { return flags[i] & HAS_SIZE; }
+    bool hasCrc32(size_t i) const { return flags[i] & HAS_CRC32; }
+    bool hasMd5(size_t i) const { return flags[i] & HAS_MD5; }
+    bool hasSha1(size_t i) const { return flags[i] & HAS_SHA1; }
+    uint64_t romSize(size_t i) const { return sizes[i]; }
+    uint32_t crc32(size_t i) const { return crcs[i]; }
+    const Md5& md5(size_t i) const { return md5s[i]; }
+    const Sha1& sha1(size_t i) const { return sha1s[i]; }
+    RomStatus status(size_t i) const { return statuses[i]; }
+    void setStatus(size_t i, RomStatus status) { statuses[i] = status; }
+
+    // Cópia no formato antigo (hex minúsculo)
+    RomEntry entry(size_t i) const;
+    std::vector<RomEntry> toEntries() const;
+
+    // Tudo que a entrada declara bate com digests (campos ausentes não contam)
+    bool matches(size_t i, const ChecksumVerifier::Digests& digests) const;
+
+    // Buscas (índices montados por buildIndex; npos se não houver)
+    void buildIndex();
+    size_t findBySha1(const Sha1& sha1) const;
+    size_t findByCrc32(uint32_t crc) const;
+    size_t findByName(std::string_view name) const;   // sem diferenciar caixa
+
+    // Diferenças entre dois catálogos indexados: merge linear das ordens
+    // por nome; com detectRenames, o que sobrou dos dois lados é casado
+    // por conteúdo (SHA1, senão CRC32 + tamanho) e sai como DAT_RENAMED.
+    // Entradas iguais não aparecem.
+    static std::vector<DatDifference> diff(const DatCatalog& first, const DatCatalog& second,
+                                           bool detectRenames = true);
+
+    // Hex (maiúsculo ou minúsculo) para bytes; false se inválido
+    static bool parseHex(std::string_view hex, uint8_t* out, size_t length);
+
+private:
+    enum : uint8_t {
+        HAS_SIZE = 1 << 0,
+        HAS_CRC32 = 1 << 1,
+        HAS_MD5 = 1 << 2,
+        HAS_SHA1 = 1 << 3
+    };
+
+    std::string names;                   // arena, sem separador
+    std::vector<uint32_t> nameOffsets{0};
+    std::vector<uint64_t> sizes;
+    std::vector<uint32_t> crcs;
+    std::vector<Md5> md5s;
+    std::vector<Sha1> sha1s;
+    std::vector<uint8_t> flags;
+    std::vector<RomStatus> statuses;
+
+    // Índices: posições ordenadas pela coluna (4 bytes por entrada),
+    // busca binária. Também servem para percorrer o DAT em ordem.
+    std::vector<uint32_t> sha1Order;
+    std::vector<uint32_t> crcOrder;
+    std::vector<uint32_t> nameOrder;
+};
@@ -1,8 +1,14 @@
 // DatIntegration.hpp - Updated version
 #pragma once
+#include <functional>
 #include <string>
 #include <vector>
 #include <unordered_map>
+#include <cstdint>
+#include "ChecksumVerifier.hpp"
+#include "TrimOptions.hpp"
+
+class DatCatalog;
 
 struct RomEntry {
     std::string name;
@@ -10,7 +16,7 @@ struct RomEntry {
     std::string crc32;
     std::string md5;
     std::string sha1;
-    std::string status;  // "ok", "missing", "modified", "only_in_first", "only_in_second"
+    std::string status;  // "ok", "trimmed", "missing", "modified", "only_in_first", "only_in_second"
 };
 
 struct RomSetStats {
@@ -32,13 +38,32 @@ public:
     
     // Parse DAT file (Logiqx XML or ClrMamePro format)
     static std::vector<RomEntry> parseDatFile(const std::string& datPath);
+
+    // Same parser, handing each entry to onEntry instead of keeping them
+    static void parseDatFile(const std::string& datPath,
+                             const std::function<void(const RomEntry&)>& onEntry);
     
     // Verify ROM against DAT entry
     static bool verifyRom(const std::string& romPath, const RomEntry& entry);
+
+    // Same against a catalog entry: numeric/binary compares, no hex strings
+    static bool verifyRom(const std::string& romPath, const DatCatalog& catalog, size_t index);
+
+    // Verify a trimmed ROM against its original entry: the removed tail is
+    // added back to the hashes in memory (CRC32 combined, digests fed from
+    // a constant block), so only the bytes left on disk are read. The
+    // padding byte that matched is stored in paddingByte when given.
+    static bool verifyTrimmedRom(const std::string& romPath, const RomEntry& entry,
+                                 uint8_t* paddingByte = nullptr);
     
     // Calculate all checksums for a file
     static std::unordered_map<std::string, std::string> calculateChecksums(
         const std::string& filePath);
+
+    // Same, as raw digests (false if the file cannot be read)
+    static bool calculateDigests(const std::string& filePath,
+                                 ChecksumVerifier::Digests& digests,
+                                 bool withSha256 = false);
     
     // Generate trimmed DAT file with updated checksums
     static bool generateTrimmedDat(
@@ -90,13 +115,22 @@ public:
     
     // ==================== INTEGRATION WITH ROMTRIMMER ====================
     
-    // Complete workflow: parse DAT, verify, trim, generate new DAT
+    // Complete workflow: parse DAT, verify, trim, generate new DAT.
+    // Each ROM is read once (in parallel across files): the original and
+    // trimmed hashes come from the same pass and the trim is written from
+    // the same mapping. Returns, by DAT name, the checksums of every
+    // verified ROM as it is on disk afterwards (trimmed only when the trim
+    // was written), plus "status" (trimmed|unchanged|would_trim|error) and
+    // "output". With trimFiles = false nothing is written but the DAT,
+    // which then repeats the original checksums.
     static std::unordered_map<std::string, std::unordered_map<std::string, std::string>>
     processDirectoryWithDat(
         const std::string& directoryPath,
         const std::string& datPath,
         bool trimFiles = true,
-        const std::string& outputDir = "");
+        const std::string& outputDir = "",
+        const std::string& outputDatPath = "",
+        const TrimOptions& options = TrimOptions());
     
 private:
     // Checksum calculation algorithms
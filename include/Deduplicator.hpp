@@ -0,0 +1,88 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+struct DedupOptions {
+    bool dryRun = false;
+    bool allowHardlinks = false;   // sem reflink, troca a duplicata por hard link
+    size_t threads = 0;            // 0 = automático
+};
+
+enum class DedupMethod {
+    NONE,        // dry-run ou falha
+    REFLINK,     // FIDEDUPERANGE: mesmos extents, inodes separados
+    HARDLINK     // mesmo inode
+};
+
+struct DedupAction {
+    fs::path original;
+    fs::path duplicate;
+    uint64_t size = 0;
+    DedupMethod method = DedupMethod::NONE;
+    std::string error;
+};
+
+struct DedupReport {
+    size_t filesScanned = 0;
+    size_t sizeCandidates = 0;    // arquivos com outro do mesmo tamanho
+    size_t hashCandidates = 0;    // ... que também bateram no início/fim
+    size_t alreadyShared = 0;     // hard links / reflinks de execuções anteriores
+    size_t groups = 0;
+    size_t duplicates = 0;
+    uint64_t reclaimedBytes = 0;  // no dry-run: o que seria liberado
+    std::vector<DedupAction> actions;
+};
+
+/**
+ * @brief Acha arquivos idênticos e faz as cópias dividirem o armazenamento.
+ *
+ * Filtra em três etapas, cada uma só sobre quem passou da anterior:
+ * tamanho (stat), CRC32 dos primeiros e últimos 64 KiB e, por fim,
+ * CRC32 + MD5 + SHA1 do arquivo inteiro (ChecksumVerifier::Stream, em
+ * paralelo no ThreadPool). Em cada grupo o primeiro caminho fica como
+ * original e os outros viram reflink dele (FIDEDUPERANGE, no próprio
+ * inode: dono e permissões ficam) ou, se permitido e o sistema de
+ * arquivos não suportar reflink, hard link.
+ */
+class Deduplicator {
+public:
+    explicit Deduplicator(const DedupOptions& options);
+
+    // Tamanho e mtime de um arquivo no momento em que foi hasheado
+    struct FileStamp {
+        uint64_t size = 0;
+        int64_t mtimeNs = 0;
+
+        bool operator==(const FileStamp& other) const {
+            return size == other.size && mtimeNs == other.mtimeNs;
+        }
+        bool operator!=(const FileStamp& other) const { return !(*this == other); }
+    };
+
+    // Lança std::runtime_error se o stat falhar
+    static FileStamp stamp(const fs::path& file);
+
+    // files na ordem em que devem ser preferidos como original
+    DedupReport run(const std::vector<fs::path>& files);
+
+    // Troca duplicate por um clone de original. O reflink vai pelo
+    // FIDEDUPERANGE: o kernel trava os intervalos, compara os bytes e só
+    // compartilha se forem iguais, então nada é sobrescrito. O hard link
+    // não tem essa garantia e só acontece se os dois arquivos ainda tiverem
+    // os carimbos de quando foram hasheados. Lança std::runtime_error se
+    // nenhum método permitido funcionar.
+    static DedupMethod replaceWithClone(const fs::path& original, const fs::path& duplicate,
+                                        bool allowHardlink,
+                                        const FileStamp& originalStamp,
+                                        const FileStamp& duplicateStamp);
+
+private:
+    DedupOptions options;
+};
+
+const char* dedupMethodName(DedupMethod method);
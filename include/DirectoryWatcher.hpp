@@ -0,0 +1,97 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <filesystem>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+/**
+ * @brief Observa um diretório (inotify) e entrega arquivos prontos.
+ *
+ * Um arquivo só é entregue depois de fechado para escrita (ou movido para
+ * dentro do diretório) e de ficar `settleTime` sem novos eventos, o que
+ * cobre cópias em andamento. A fila de prontos é limitada: se encher, a
+ * thread do watcher espera o consumidor. Se o kernel descartar eventos
+ * (IN_Q_OVERFLOW) o diretório é reescaneado.
+ *
+ * Disponível apenas no Linux; nas outras plataformas start() retorna false.
+ */
+class DirectoryWatcher {
+public:
+    struct Settings {
+        std::chrono::milliseconds settleTime{500};
+        size_t maxQueued = 1024;
+        bool recursive = false;
+    };
+
+    using Filter = std::function<bool(const fs::path&)>;
+
+    DirectoryWatcher(const fs::path& directory, const Settings& settings, Filter filter);
+    ~DirectoryWatcher();
+
+    DirectoryWatcher(const DirectoryWatcher&) = delete;
+    DirectoryWatcher& operator=(const DirectoryWatcher&) = delete;
+
+    static bool isSupported();
+
+    // Abre o inotify e inicia a thread de eventos
+    bool start();
+    void stop();
+
+    // Espera até `timeout` pelo próximo arquivo pronto
+    bool next(fs::path& file, std::chrono::milliseconds timeout);
+
+    // false depois de stop() ou se a thread de eventos parou sozinha
+    // (lastError() diz por quê)
+    bool isRunning() const { return running; }
+    size_t overflowCount() const { return overflows; }
+    const std::string& lastError() const { return error; }
+
+    // Falhas que não param o watcher (subdiretório que não pôde ser
+    // observado), desde a última chamada
+    std::vector<std::string> takeWarnings();
+
+private:
+    fs::path directory;
+    Settings settings;
+    Filter filter;
+    std::string error;
+
+    int inotifyFd = -1;
+    std::unordered_map<int, fs::path> watches;
+
+    // Arquivos vistos, aguardando o tempo de estabilização
+    std::unordered_map<std::string, std::chrono::steady_clock::time_point> pending;
+
+    // Fila de prontos (limitada)
+    std::deque<fs::path> ready;
+    std::unordered_set<std::string> queued;
+    std::mutex queueMutex;
+    std::condition_variable readyCondition;
+    std::condition_variable spaceCondition;
+
+    // Avisos pendentes (sob queueMutex); limitados se ninguém os lê
+    static constexpr size_t MAX_WARNINGS = 256;
+    std::vector<std::string> warnings;
+
+    std::thread worker;
+    std::atomic<bool> running{false};
+    std::atomic<size_t> overflows{0};
+
+    void eventLoop();
+    bool addWatch(const fs::path& dir);
+    void readEvents();
+    void flushSettled();
+    void rescan();
+    void enqueue(const fs::path& file);
+};
@@ -0,0 +1,159 @@
+#pragma once
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <cmath>
+#include <cstdio>
+
+/**
+ * @brief Monta um objeto JSON compacto em uma linha (NDJSON).
+ *
+ * Só o necessário para os registros de resultado: campos escalares e
+ * arrays de strings, sem aninhamento de objetos. Strings são tratadas como
+ * UTF-8; bytes que não formam UTF-8 válido saem como U+FFFD.
+ *
+ * @code
+ * JsonWriter json;
+ * json.field("path", file.string()).field("size", size);
+ * out << json.finish() << '\n';
+ * @endcode
+ */
+class JsonWriter {
+public:
+    JsonWriter() : out("{") {}
+
+    JsonWriter& field(std::string_view name, std::string_view value) {
+        key(name);
+        quoted(value);
+        return *this;
+    }
+
+    JsonWriter& field(std::string_view name, const char* value) {
+        return field(name, std::string_view(value));
+    }
+
+    JsonWriter& field(std::string_view name, bool value) {
+        key(name);
+        out += value ? "true" : "false";
+        return *this;
+    }
+
+    template <typename T,
+              std::enable_if_t<std::is_integral_v<T> && !std::is_same_v<T, bool>, int> = 0>
+    JsonWriter& field(std::string_view name, T value) {
+        key(name);
+        out += std::to_string(value);
+        return *this;
+    }
+
+    template <typename T, std::enable_if_t<std::is_floating_point_v<T>, int> = 0>
+    JsonWriter& field(std::string_view name, T value) {
+        key(name);
+        if (!std::isfinite(value)) {
+            out += "null";
+            return *this;
+        }
+        char buffer[32];
+        std::snprintf(buffer, sizeof(buffer), "%.6g", static_cast<double>(value));
+        out += buffer;
+        return *this;
+    }
+
+    template <typename Container>
+    JsonWriter& stringArray(std::string_view name, const Container& values) {
+        key(name);
+        out += '[';
+        bool firstValue = true;
+        for (const auto& value : values) {
+            if (!firstValue) out += ',';
+            firstValue = false;
+            quoted(value);
+        }
+        out += ']';
+        return *this;
+    }
+
+    // Fecha o objeto e devolve a linha (sem '\n')
+    std::string finish() {
+        out += '}';
+        return std::move(out);
+    }
+
+private:
+    std::string out;
+    bool first = true;
+
+    void key(std::string_view name) {
+        if (!first) out += ',';
+        first = false;
+        quoted(name);
+        out += ':';
+    }
+
+    // Bytes de uma sequência UTF-8 válida começando em text[i], ou 0
+    // (continuação solta, overlong, surrogate, acima de U+10FFFF, truncada)
+    static size_t utf8Length(std::string_view text, size_t i) {
+        auto byte = [&](size_t k) { return static_cast<unsigned char>(text[k]); };
+        unsigned char lead = byte(i);
+        size_t length;
+        unsigned char low = 0x80;
+        unsigned char high = 0xBF;
+        if (lead >= 0xC2 && lead <= 0xDF) {
+            length = 2;
+        } else if (lead >= 0xE0 && lead <= 0xEF) {
+            length = 3;
+            if (lead == 0xE0) low = 0xA0;
+            if (lead == 0xED) high = 0x9F;
+        } else if (lead >= 0xF0 && lead <= 0xF4) {
+            length = 4;
+            if (lead == 0xF0) low = 0x90;
+            if (lead == 0xF4) high = 0x8F;
+        } else {
+            return 0;
+        }
+        if (text.size() - i < length || byte(i + 1) < low || byte(i + 1) > high) {
+            return 0;
+        }
+        for (size_t k = 2; k < length; ++k) {
+            if ((byte(i + k) & 0xC0) != 0x80) {
+                return 0;
+            }
+        }
+        return length;
+    }
+
+    void quoted(std::string_view text) {
+        out += '"';
+        for (size_t i = 0; i < text.size(); ++i) {
+            char c = text[i];
+            if (static_cast<unsigned char>(c) >= 0x80) {
+                // Caminhos no Linux são bytes quaisquer; a linha precisa
+                // continuar JSON válido, então o inválido vira U+FFFD
+                size_t length = utf8Length(text, i);
+                if (length == 0) {
+                    out += "\\ufffd";
+                } else {
+                    out.append(text.data() + i, length);
+                    i += length - 1;
+                }
+                continue;
+            }
+            switch (c) {
+                case '"':  out += "\\\""; break;
+                case '\\': out += "\\\\"; break;
+                case '\n': out += "\\n"; break;
+                case '\r': out += "\\r"; break;
+                case '\t': out += "\\t"; break;
+                default:
+                    if (static_cast<unsigned char>(c) < 0x20) {
+                        char escaped[8];
+                        std::snprintf(escaped, sizeof(escaped), "\\u%04x", c);
+                        out += escaped;
+                    } else {
+                        out += c;
+                    }
+            }
+        }
+        out += '"';
+    }
+};
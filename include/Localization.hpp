@@ -20,28 +20,25 @@ inline std::string tr(const char* msg) {
 
 // ==================== MACRO PRINCIPAL ====================
 /**
- * @brief Macro para obter string traduzida
+ * @brief Macro para obter string traduzida (definida em LocalizationManager.hpp)
  * 
+ * A chave é convertida para TrKey em tempo de compilação e o retorno é um
+ * std::string_view para dados estáticos, sem alocação.
+ *
  * Exemplos de uso:
  * @code
  * std::cout << TR("WELCOME_MESSAGE") << std::endl;
- * logger->log(TR("ERROR_PROCESSING_FILE"), LogLevel::ERROR);
+ * LOG_ERROR(*logger, std::string(TR("ERROR_PROCESSING")) + path);
  * @endcode
  */
-#define TR(key) LocalizationManager::instance().getString(key)
 
 // ==================== VERIFICAÇÃO EM TEMPO DE COMPILAÇÃO ====================
-#ifdef _DEBUG
-    /**
-     * @brief Verifica se uma chave de tradução existe (apenas em debug)
-     */
-    inline void TR_CHECK(const std::string& key) {
-        // Tentar obter a tradução, se falhar será óbvio
-        LocalizationManager::instance().getString(key);
-    }
-#else
-    #define TR_CHECK(key) ((void)0)
-#endif
+/**
+ * @brief Verifica se uma chave de tradução existe
+ *
+ * Chave inexistente não compila.
+ */
+#define TR_CHECK(key) ((void)TR_KEY(key))
 
 // ==================== FUNÇÕES AUXILIARES ====================
 namespace Localization {
@@ -1,12 +1,21 @@
 #pragma once
 #include <string>
-#include <map>
+#include <string_view>
+#include <array>
+#include <memory>
+#include <mutex>
 #include <algorithm>
 
+#include "TranslationKeys.hpp"
+
 enum class Language { EN, PT, ES, FR, AR, HI, BN, RU, ZH };
+constexpr size_t LANGUAGE_COUNT = 9;
 
 class LocalizationManager {
 public:
+    // Tabela plana de uma língua, indexada por TrKey
+    using TrTable = std::array<std::string_view, TR_KEY_COUNT>;
+
     // Singleton: acesso global
     static LocalizationManager& instance();
 
@@ -14,8 +23,9 @@ public:
     void setLanguage(Language lang);
     void setLanguage(const std::string& langCode);
 
-    // Get translated string
-    std::string getString(const std::string& key);
+    // Get translated string (sem alocação; aponta para dados estáticos)
+    std::string_view get(TrKey key) const;
+    std::string_view getString(std::string_view key) const;
     std::string getLanguageCode() const;
 
     // Prompt user for language
@@ -25,12 +35,13 @@ private:
     // Construtor privado
     LocalizationManager();
 
-    // Carrega todas traduções
-    void loadTranslations();
+    // Tabela da língua, decodificada do catálogo embutido no primeiro uso
+    const TrTable& table(Language lang) const;
 
     Language currentLang;
-    std::map<Language, std::map<std::string, std::string>> translations;
+    mutable std::array<std::unique_ptr<TrTable>, LANGUAGE_COUNT> tables;
+    mutable std::array<std::once_flag, LANGUAGE_COUNT> loaded;
 };
 
-// Macro de tradução rápida
-#define TR(key) LocalizationManager::instance().getString(key)
\ No newline at end of file
+// Macro de tradução rápida: chave resolvida em tempo de compilação
+#define TR(key) LocalizationManager::instance().get(TR_KEY(key))
@@ -1,8 +1,16 @@
 #pragma once
 #include <string>
+#include <string_view>
 #include <vector>
 #include <deque>
 #include <fstream>
+#include <mutex>
+
+// Nível mínimo compilado (0=DEBUG, 1=INFO, 2=WARNING, 3=ERROR).
+// Chamadas abaixo deste nível via LOG_* somem do binário.
+#ifndef ROMTRIMMER_MIN_LOG_LEVEL
+    #define ROMTRIMMER_MIN_LOG_LEVEL 0
+#endif
 
 enum class LogLevel {
     DEBUG,
@@ -16,9 +24,18 @@ public:
     Logger();
     ~Logger() = default;
 
-    void log(const std::string& message, LogLevel level = LogLevel::INFO);
+    void log(std::string_view message, LogLevel level = LogLevel::INFO);
     void setLogFile(const std::string& filename);
 
+    void setLogLevel(LogLevel level) { logLevel = level; }
+    LogLevel getLogLevel() const { return logLevel; }
+
+    // Verificação barata antes de montar qualquer mensagem
+    bool isEnabled(LogLevel level) const {
+        return static_cast<int>(level) >= ROMTRIMMER_MIN_LOG_LEVEL &&
+               static_cast<int>(level) >= static_cast<int>(logLevel);
+    }
+
     std::vector<std::string> getRecentLogs(size_t count = 50) const;
 
 private:
@@ -26,8 +43,32 @@ private:
     bool logToFile = false;
     std::ofstream logFile;
     std::deque<std::string> logBuffer;
+    mutable std::mutex logMutex; // log() pode vir de várias threads (--watch)
 
     std::string getTimestamp() const;
     std::string levelToString(LogLevel level) const;
     void outputToConsole(const std::string& message, LogLevel level);
-};
\ No newline at end of file
+};
+
+// ==================== FRONT-END PREGUIÇOSO ====================
+/**
+ * Só avalia `message` (concatenações, TR(), to_string...) se o nível
+ * estiver habilitado. Com nível constante abaixo de ROMTRIMMER_MIN_LOG_LEVEL
+ * o compilador elimina a chamada inteira.
+ *
+ * @code
+ * LOG_DEBUG(*logger, "  - " + file.string());
+ * @endcode
+ */
+#define ROMTRIMMER_LOG(loggerRef, level, message)                          \
+    do {                                                                   \
+        if (static_cast<int>(level) >= ROMTRIMMER_MIN_LOG_LEVEL &&         \
+            (loggerRef).isEnabled(level)) {                                \
+            (loggerRef).log((message), (level));                           \
+        }                                                                  \
+    } while (0)
+
+#define LOG_DEBUG(loggerRef, message)   ROMTRIMMER_LOG(loggerRef, LogLevel::DEBUG, message)
+#define LOG_INFO(loggerRef, message)    ROMTRIMMER_LOG(loggerRef, LogLevel::INFO, message)
+#define LOG_WARNING(loggerRef, message) ROMTRIMMER_LOG(loggerRef, LogLevel::WARNING, message)
+#define LOG_ERROR(loggerRef, message)   ROMTRIMMER_LOG(loggerRef, LogLevel::ERROR, message)
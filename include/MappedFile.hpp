@@ -0,0 +1,61 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <string_view>
+
+namespace fs = std::filesystem;
+
+/**
+ * @brief Arquivo somente leitura exposto como std::string_view.
+ *
+ * Usa mmap quando possível (sem cópia); se o mapeamento falhar, lê para
+ * um buffer interno que é reaproveitado entre chamadas de open().
+ */
+class MappedFile {
+public:
+    MappedFile() = default;
+    explicit MappedFile(const fs::path& path) { open(path); }
+    ~MappedFile() { close(); }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+    MappedFile(MappedFile&& other) noexcept;
+    MappedFile& operator=(MappedFile&& other) noexcept;
+
+    // Lança std::runtime_error se o arquivo não puder ser aberto/lido
+    void open(const fs::path& path);
+    void close();
+
+    std::string_view view() const { return {data, length}; }
+    size_t size() const { return length; }
+    bool isMapped() const { return mapped; }
+    const fs::path& path() const { return filePath; }
+
+private:
+    fs::path filePath;
+    const char* data = nullptr;
+    size_t length = 0;
+    bool mapped = false;
+    std::string fallback;
+};
+
+// Copia [offset, offset + length) de source para um target novo. No Linux
+// usa copy_file_range (o kernel copia, ou compartilha extents em btrfs/XFS);
+// senão, leitura e escrita em blocos. Lança std::runtime_error em falha.
+void copyFileRegion(const fs::path& source, size_t offset, size_t length,
+                    const fs::path& target);
+
+// Renomeia source para target só se target ainda não existir, sem janela
+// entre checar e renomear (Linux: renameat2 RENAME_NOREPLACE; senão
+// link + unlink). false = destino já existe; outros erros lançam
+// std::runtime_error.
+bool renameNoReplace(const fs::path& source, const fs::path& target);
+
+// Desaloca [offset, offset + length) sem mudar o tamanho lógico
+// (fallocate PUNCH_HOLE | KEEP_SIZE): o trecho passa a ler como zeros.
+// Devolve quantos bytes de disco foram liberados (st_blocks antes/depois).
+// Lança std::runtime_error se a plataforma ou o sistema de arquivos não
+// suportar.
+uint64_t punchFileHole(const fs::path& file, size_t offset, size_t length);
@@ -0,0 +1,36 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <string_view>
+
+/**
+ * @brief Ordem dos bytes de uma imagem N64, pela primeira palavra.
+ *
+ * DATs (No-Intro) usam sempre a ordem .z64; .v64 troca os bytes de cada
+ * palavra de 16 bits e .n64 inverte cada palavra de 32 bits.
+ */
+enum class N64ByteOrder {
+    UNKNOWN,
+    Z64,    // big-endian, 80 37 12 40
+    V64,    // byte-swapped, 37 80 40 12
+    N64     // little-endian, 40 12 37 80
+};
+
+N64ByteOrder detectN64ByteOrder(std::string_view head);
+
+inline bool needsN64Normalization(N64ByteOrder order) {
+    return order == N64ByteOrder::V64 || order == N64ByteOrder::N64;
+}
+
+// Copia size bytes de src para dst já na ordem .z64 (dst pode ser src).
+// Bytes que sobram depois da última palavra completa são copiados como estão.
+void normalizeN64(const char* src, char* dst, size_t size, N64ByteOrder order);
+
+// Bloco usado por quem normaliza em streaming (hash, escrita): cabe no L2
+constexpr size_t N64_STREAM_CHUNK = 256 * 1024;
+
+// Grava data em path na ordem .z64, bloco a bloco, sem cópia intermediária
+// do arquivo inteiro. Lança std::runtime_error em falha de escrita.
+void writeN64AsZ64(const std::filesystem::path& path, std::string_view data,
+                   N64ByteOrder order);
@@ -0,0 +1,52 @@
+#pragma once
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+
+/**
+ * @brief Saída NDJSON bufferizada, independente do Logger.
+ *
+ * Cada write() acrescenta uma linha completa ao buffer; o buffer vai para o
+ * descritor quando passa de `capacity` bytes ou, por uma thread própria,
+ * `flushInterval` depois do primeiro registro pendente. Um registro nunca
+ * espera mais que isso, mesmo que o próximo arquivo demore. Linhas nunca
+ * são cortadas ao meio, então o consumidor pode ler o pipe linha a linha
+ * enquanto o lote roda. flushInterval = 0 descarrega a cada registro
+ * (modo --watch) e não cria a thread.
+ */
+class NdjsonWriter {
+public:
+    explicit NdjsonWriter(int fd = 1,
+                          std::chrono::milliseconds flushInterval = std::chrono::milliseconds(100),
+                          size_t capacity = 64 * 1024);
+    ~NdjsonWriter();
+
+    NdjsonWriter(const NdjsonWriter&) = delete;
+    NdjsonWriter& operator=(const NdjsonWriter&) = delete;
+
+    // Uma linha JSON sem '\n'. Pode ser chamada de várias threads.
+    void write(std::string_view record);
+    void flush();
+
+    // true depois de um erro de escrita (ex.: pipe fechado); registros
+    // seguintes são descartados
+    bool failed() const { return writeFailed; }
+
+private:
+    int fd;
+    std::chrono::milliseconds flushInterval;
+    size_t capacity;
+    std::string buffer;
+    std::chrono::steady_clock::time_point firstPending;   // quando o buffer deixou de estar vazio
+    bool writeFailed = false;
+    bool stopping = false;
+    std::mutex mutex;
+    std::condition_variable wakeup;
+    std::thread flusher;
+
+    void flushLocked();
+    void flusherLoop();
+};
@@ -0,0 +1,21 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+/**
+ * @brief Extensão real de uma imagem NDS segundo o próprio header.
+ *
+ * dataEnd é o maior fim entre: tamanho usado declarado (0x80, ou 0x210 em
+ * cartuchos DSi), assinatura RSA do download play logo após ele, seções
+ * ARM9/ARM7/FNT/FAT/overlays, ícone/título e o maior arquivo listado na FAT.
+ * Só lê o header e a FAT, nunca a cauda do arquivo.
+ */
+struct NdsLayout {
+    bool valid = false;
+    size_t usedSize = 0;
+    size_t dataEnd = 0;
+    bool hasDownloadPlaySignature = false;
+};
+
+NdsLayout parseNdsLayout(std::string_view data);
@@ -1,5 +1,6 @@
 #pragma once
 #include <string>
+#include <string_view>
 #include <vector>
 #include <cstdint>
 #include "RomDetector.hpp"
@@ -10,7 +11,7 @@ struct PaddingAnalysis {
     size_t paddingSize = 0;
     uint8_t paddingByte = 0xFF;
     double confidence = 0.0; // 0.0 a 1.0
-    std::string patternType = "continuous"; // continuous, alternating, mixed
+    std::string patternType = "continuous"; // continuous, alternating, repeating, mixed, header
 };
 
 class PaddingAnalyzer {
@@ -18,38 +19,78 @@ public:
     PaddingAnalyzer() = default;
     ~PaddingAnalyzer() = default;
     
-    PaddingAnalysis analyze(const std::string& data, uint8_t paddingByte);
+    PaddingAnalysis analyze(std::string_view data, uint8_t paddingByte);
+
+    // Com o tipo conhecido: NDS calcula o corte pelo header (O(1)) e só
+    // confere janelas pequenas; se o header não bater, varre como acima
+    PaddingAnalysis analyze(std::string_view data, uint8_t paddingByte, RomType romType);
     
-    uint8_t autoDetectPadding(const std::string& data, RomType romType);
+    // Modo auto numa varredura só: a única sequência final possível é a do
+    // último byte, então ele é o candidato. 0xFF (e 0x00 fora do GBA) vale
+    // com qualquer tamanho; outros valores (0xCD, 0xAA...) só com pelo
+    // menos MIN_OTHER_PADDING bytes, senão são dados. GBA terminado em 0x00
+    // não tem padding em auto, qualquer que seja o tamanho da sequência
+    PaddingAnalysis analyzeAuto(std::string_view data, RomType romType);
+
+    // Só o byte escolhido pelo modo auto (olha no máximo MIN_OTHER_PADDING bytes)
+    uint8_t autoDetectPadding(std::string_view data, RomType romType);
+
+    static constexpr size_t MIN_OTHER_PADDING = 4096;
     
-    // Métodos avançados de análise
-    bool hasAlternatingPattern(const std::string& data, uint8_t paddingByte);
-    bool hasMixedPadding(const std::string& data);
-    double calculatePaddingConfidence(const std::string& data, 
+    // Métodos avançados de análise (todos derivados do mesmo perfil da cauda)
+    bool hasAlternatingPattern(std::string_view data, uint8_t paddingByte);
+    bool hasMixedPadding(std::string_view data);
+    double calculatePaddingConfidence(std::string_view data, 
                                      uint8_t paddingByte, 
                                      size_t paddingStart);
+
+    // Começo da sequência final de paddingByte (data.size() se não houver)
+    size_t findTrueEndOfData(std::string_view data, uint8_t paddingByte);
     
 private:
+    struct PatternResult {
+        bool isAlternating = false;   // FF/00 alternados
+        bool isRepeating = false;     // outro padrão curto (período <= 16)
+        size_t patternLength = 0;     // período; 0 = nenhum
+        size_t span = 0;              // bytes cobertos, terminando em end
+    };
+
+    // Perfil da cauda numa passada: a sequência final de paddingByte
+    // (varrida em blocos SIMD) e uma janela logo antes dela, com
+    // histograma, runs de 0x00/0xFF e período colado no começo do padding
+    struct TailProfile {
+        uint8_t paddingByte = 0xFF;
+        size_t paddingStart = 0;
+        size_t windowStart = 0;
+        size_t histogram[256] = {};
+        size_t paddingRuns = 0;       // runs >= MIN_RUN de 0x00/0xFF na janela
+        size_t longestRun = 0;
+        size_t otherPaddingRun = 0;   // run do outro byte colado no padding
+        PatternResult pattern;
+    };
+
+    static constexpr size_t PROFILE_WINDOW = 64 * 1024;
+    static constexpr size_t MIN_RUN = 16;
+    static constexpr size_t MIXED_MIN_RUN = 1024;
+
+    TailProfile profileTail(std::string_view data, uint8_t paddingByte);
+    bool excludedFromAuto(uint8_t paddingByte, RomType romType) const;
+    size_t minimumPaddingFor(uint8_t paddingByte) const;
+    double confidenceFromProfile(const TailProfile& profile, size_t totalSize);
+
+    bool analyzeNdsHeader(std::string_view data, uint8_t paddingByte,
+                          PaddingAnalysis& result);
+
     double adjustConfidenceForRomType(double baseConfidence, 
                                      size_t paddingSize, 
                                      size_t totalSize);
     
-    bool validatePaddingRegion(const std::string& data, 
+    bool validatePaddingRegion(std::string_view data, 
                               size_t start, 
                               size_t end, 
                               uint8_t paddingByte);
     
-    size_t findTrueEndOfData(const std::string& data, 
-                            uint8_t paddingByte,
-                            size_t safetyMargin = 1024);
-    
-    struct PatternResult {
-        bool isAlternating = false;
-        bool isRepeating = false;
-        size_t patternLength = 0;
-    };
-    
-    PatternResult analyzePattern(const std::string& data, 
+    PatternResult analyzePattern(std::string_view data, 
                                 size_t start, 
                                 size_t end);
 };
\ No newline at end of file
@@ -1,6 +1,7 @@
 // ReversePadding.hpp
 #pragma once
 #include <string>
+#include <string_view>
 #include <vector>
 #include <cstdint>
 
@@ -16,18 +17,18 @@ public:
     
     // Create patch to restore padding
     static std::vector<uint8_t> createRestorationPatch(
-        const std::string& originalData,
-        const std::string& trimmedData,
+        std::string_view originalData,
+        std::string_view trimmedData,
         uint8_t paddingByte);
     
     // Apply patch to restore padding
     static std::string applyRestorationPatch(
-        const std::string& trimmedData,
+        std::string_view trimmedData,
         const std::vector<uint8_t>& patch);
     
     // Simple restoration (just add padding bytes)
     static std::string restorePaddingSimple(
-        const std::string& trimmedData,
+        std::string_view trimmedData,
         size_t originalSize,
         uint8_t paddingByte);
     
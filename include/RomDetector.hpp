@@ -1,27 +1,65 @@
 #pragma once
 #include <string>
+#include <string_view>
 #include <cstdint>
+#include <filesystem>
 
 enum class RomType {
     UNKNOWN,
     GBA,
     NDS,
     GB,
-    GBC
+    GBC,
+    NES,
+    SNES,
+    N64,
+    MEGADRIVE
 };
 
+// Nome curto e estável do tipo (saídas para máquina: NDJSON, socket)
+inline const char* romTypeName(RomType type) {
+    switch (type) {
+        case RomType::GBA:       return "GBA";
+        case RomType::NDS:       return "NDS";
+        case RomType::GB:        return "GB";
+        case RomType::GBC:       return "GBC";
+        case RomType::NES:       return "NES";
+        case RomType::SNES:      return "SNES";
+        case RomType::N64:       return "N64";
+        case RomType::MEGADRIVE: return "MD";
+        default:                 return "UNKNOWN";
+    }
+}
+
+/**
+ * @brief Identifica o console pelas assinaturas do header.
+ *
+ * Cada console é uma entrada de uma tabela (RomDetector.cpp) avaliada sobre
+ * os primeiros HEADER_WINDOW bytes; nada além disso é lido, então detectar
+ * custa O(header) independente do tamanho da ROM.
+ */
 class RomDetector {
 public:
     RomDetector() = default;
     ~RomDetector() = default;
-    
-    RomType detect(const std::string& data);
-    
-private:
-    bool isGbaRom(const std::string& data);
-    bool isNdsRom(const std::string& data);
-    bool isGbRom(const std::string& data);
-    
-    size_t findLastNonPadding(const std::string& data, uint8_t padding);
-    bool isPowerOfTwo(size_t n);
-};
\ No newline at end of file
+
+    // Maior offset consultado por alguma assinatura (header SNES HiROM
+    // depois de um header de copiadora de 512 bytes)
+    static constexpr size_t HEADER_WINDOW = 0x200 + 0x10000;
+
+    RomType detect(std::string_view data);
+
+    // Mesmo que detect(), com só o começo do arquivo em mãos
+    RomType detectHeader(std::string_view head, size_t fileSize);
+
+    // Pré-classificação antes de abrir o arquivo inteiro. Como a detecção
+    // só olha o header, worthReading = false garante que detect() sobre o
+    // arquivo inteiro também daria UNKNOWN.
+    struct Probe {
+        RomType type = RomType::UNKNOWN;
+        bool worthReading = false;
+    };
+
+    Probe probe(std::string_view head, size_t fileSize);
+    Probe probeFile(const std::filesystem::path& file);
+};
@@ -16,6 +16,8 @@
 #include "SafetyValidator.hpp"
 #include "ConfigManager.hpp"
 #include "TrimOptions.hpp"
+#include "NdjsonWriter.hpp"
+#include "MappedFile.hpp"
 
 namespace fs = std::filesystem;
 
@@ -49,6 +51,34 @@ private:
     bool createTarGzArchive(const fs::path& filePath, const fs::path& archivePath);
     std::string generateArchiveName(const fs::path& originalPath);
 
+    // Modo --watch: processo único alimentado pelo inotify
+    fs::path watchDir;
+    int watchSettleMs = 500;
+    size_t watchQueueSize = 1024;
+    void runWatchMode();
+
+    // Modo --serve: serviço residente em socket Unix
+    fs::path serveSocket;
+    fs::path datPath;
+    size_t threadCount = 0; // 0 = automático
+    void runServeMode();
+
+    // Modo --dedup: duplicatas viram reflinks (ou hard links)
+    bool dedupMode = false;
+    bool dedupHardlinks = false;
+    void runDedupMode();
+
+    // Modo --chunk-report: economia de um armazenamento com dedup por chunks
+    bool chunkReportMode = false;
+    uint32_t chunkAverageSize = 8192;
+    fs::path chunkPackPath;
+    std::vector<fs::path> inputRoots;   // -p como veio, antes do collectFiles
+    void runChunkReportMode();
+
+    // Modo --chunk-unpack: remonta um pack em -o
+    fs::path chunkUnpackPath;
+    void runChunkUnpackMode();
+
     // Novas funções para lidar com extensões personalizadas
     void processCustomExtensions(const std::string& extensions);
     bool isSupportedFileExtension(const fs::path& filePath, const std::unordered_set<std::string>& customExtensions);
@@ -72,8 +102,16 @@ private:
     size_t trimmedSize = 0;
     double savedRatio = 0.0;
     std::string romType;
+    RomType type = RomType::UNKNOWN;
+    uint8_t paddingByte = 0;
+    size_t trimPoint = 0;
+    size_t headerSize = 0;   // header de copiadora antes do payload (SNES)
+    double confidence = 0.0;
     bool trimmed = false;
     bool rezipped = false;
+    bool unknownType = false;    // o detector leu o arquivo e não reconheceu
+    bool notPunchable = false;   // --sparse: cauda não é toda 0x00
+    bool unsafeSkipped = false;  // validação falhou (--force só registra o aviso)
     std::vector<std::string> warnings;
     std::string error;
     
@@ -81,8 +119,22 @@ private:
     std::chrono::steady_clock::time_point startTime;
     std::chrono::steady_clock::time_point endTime;
     std::chrono::milliseconds duration{0};
+
+    // Tempo por etapa (ms); write cobre backup, escrita e rezip
+    double readMs = 0.0;
+    double detectMs = 0.0;
+    double paddingMs = 0.0;
+    double validateMs = 0.0;
+    double writeMs = 0.0;
+    std::chrono::steady_clock::time_point actionStart{};
 };
 
+    // --format ndjson: um registro JSON por arquivo em stdout, assim que
+    // o arquivo termina (logs vão para stderr)
+    std::unique_ptr<NdjsonWriter> resultWriter;
+    void emitFileRecord(const FileStats& stats);
+    void emitSummaryRecord();
+
     // Core
     TrimOptions options;
     std::unique_ptr<Logger> logger;
@@ -112,20 +164,22 @@ private:
 
     void processFiles();
     bool processFile(const fs::path& filePath);
-    uint8_t determinePaddingByte(const std::string& data, RomType romType);
+    PaddingAnalysis analyzePadding(std::string_view data, RomType romType);
     void handleValidationFailure(const ValidationResult& validation, FileStats& stats);
-    bool executeFileAction(const fs::path& filePath, const std::string& data,
+    bool executeFileAction(const fs::path& filePath, MappedFile& input,
                           size_t trimPoint, FileStats& stats);
-    bool handleAnalysisMode(const std::string& data, size_t trimPoint, FileStats& stats);
-    bool handleDryRunMode(const std::string& data, size_t trimPoint, FileStats& stats);
-    bool handleActualTrim(const fs::path& filePath, const std::string& data,
+    bool handleAnalysisMode(std::string_view data, FileStats& stats);
+    bool handleDryRunMode(std::string_view data, FileStats& stats);
+    bool handleActualTrim(const fs::path& filePath, MappedFile& input,
                          size_t trimPoint, FileStats& stats);
     void handleProcessingError(const fs::path& filePath, const std::string& error,
                               FileStats& stats);
 
     // Operações de arquivo
-    bool writeTrimmedFile(const fs::path& filePath, const std::string& data, size_t trimPoint);
-    std::string readFile(const fs::path& filePath);
+    // --sparse: mesmo tamanho, [trimPoint, fim) vira buraco; freedBytes = disco liberado
+    bool punchPaddingHole(const fs::path& filePath, MappedFile& input, size_t trimPoint,
+                          uint64_t& freedBytes);
+    void openRomFile(const fs::path& filePath, MappedFile& input);
     fs::path determineOutputPath(const fs::path& inputPath);
     void createBackup(const fs::path& filePath) const;
 
@@ -148,9 +202,10 @@ private:
     std::atomic<size_t> filesTrimmed{0};
     std::atomic<size_t> filesFailed{0};
     std::atomic<size_t> totalSaved{0};
+    std::atomic<size_t> filesRezipped{0};
 
     std::mutex statsMutex;
-    std::vector<FileStats> fileStats;
+    std::vector<FileStats> fileStats;   // por arquivo; fica vazio no --watch
     
     
     
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <string>
+#include <string_view>
 #include <vector>
 #include <cstdint>
 #include <cstddef>
@@ -11,14 +12,18 @@
 
 class SafetyValidator {
 public:
-    ValidationResult validate(const std::string& data,
+    ValidationResult validate(std::string_view data,
                           size_t trimPoint,
                           RomType romType,
                           const TrimOptions& options);
 
-    bool validateGba(const std::string& data, size_t trimPoint);
-    bool validateNds(const std::string& data, size_t trimPoint);
-    bool validateGb(const std::string& data, size_t trimPoint);
+    bool validateGba(std::string_view data, size_t trimPoint);
+    bool validateNds(std::string_view data, size_t trimPoint);
+    bool validateGb(std::string_view data, size_t trimPoint);
+    bool validateNes(std::string_view data, size_t trimPoint);
+    bool validateSnes(std::string_view data, size_t trimPoint);
+    bool validateN64(std::string_view data, size_t trimPoint);
+    bool validateMegaDrive(std::string_view data, size_t trimPoint);
 
     struct RiskAssessment {
         enum class RiskLevel { LOW, MEDIUM, HIGH, CRITICAL };
@@ -27,7 +32,7 @@ public:
         std::vector<std::string> riskFactors;
     };
 
-    RiskAssessment assessRisk(const std::string& data,
+    RiskAssessment assessRisk(std::string_view data,
                               size_t trimPoint,
                               RomType romType);
 
@@ -35,15 +40,15 @@ private:
     size_t getMinSizeForRomType(RomType type);
     size_t getRecommendedSizeForRomType(RomType type);
 
-    bool validateGbaInternalRomSize(const std::string& data, size_t trimPoint);
-    bool validateNdsSectionOffsets(const std::string& data, size_t trimPoint);
+    bool validateGbaInternalRomSize(std::string_view data, size_t trimPoint);
+    bool validateNdsSectionOffsets(std::string_view data, size_t trimPoint);
     bool validateGbRomSize(size_t size);
 
-    bool validateKnownStructuresInternal(const std::string& data,
+    bool validateKnownStructuresInternal(std::string_view data,
                                          size_t trimPoint,
                                          RomType romType);
 
-    uint32_t readU32(const std::string& data, size_t offset);
+    uint32_t readU32(std::string_view data, size_t offset);
 
     static constexpr size_t MIN_GBA_SIZE = 1024 * 1024;
     static constexpr size_t MIN_NDS_SIZE = 8 * 1024 * 1024;
@@ -0,0 +1,23 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+// Header que copiadoras (SWC/FIG/UFO) colam antes da ROM em dumps .smc
+constexpr size_t SNES_COPIER_HEADER_SIZE = 0x200;
+
+/**
+ * @brief Onde está o header interno de uma ROM SNES.
+ *
+ * copierHeader é quanto pular até o payload (0 ou 512). Tudo que depende
+ * de offsets (padding, validação, hash de DAT) deve olhar só o payload:
+ * data.substr(copierHeader). Só lê o header, nunca o resto do arquivo.
+ */
+struct SnesLayout {
+    bool valid = false;
+    size_t copierHeader = 0;
+    size_t headerOffset = 0;   // header interno, relativo ao payload
+    bool hiRom = false;
+};
+
+SnesLayout parseSnesLayout(std::string_view head, size_t fileSize);
@@ -0,0 +1,174 @@
+#pragma once
+
+/**
+ * @file TranslationKeys.hpp
+ * @brief Chaves de tradução resolvidas em tempo de compilação
+ *
+ * Cada chave vira um índice inteiro (TrKey). TR("CHAVE") converte o literal
+ * para o índice durante a compilação, então uma chave inexistente é erro de
+ * build e a busca em tempo de execução é só um acesso a array.
+ *
+ * Para adicionar uma chave: inclua-a na lista abaixo e no catálogo em inglês
+ * (LocalizationManager.cpp). Línguas sem a chave usam o texto em inglês.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string_view>
+
+// ==================== LISTA DE CHAVES ====================
+#define ROMTRIMMER_TR_KEYS(X) \
+    X(START_MSG) \
+    X(SIMULATION_MODE) \
+    X(ANALYSIS_MODE) \
+    X(PROCESSING) \
+    X(UNKNOWN_ROM) \
+    X(NO_PADDING) \
+    X(TRIM_SUCCESS) \
+    X(SAVED_SPACE) \
+    X(EXEC_SUMMARY) \
+    X(NO_INPUT) \
+    X(USAGE) \
+    X(EXAMPLES) \
+    X(OPTIONS) \
+    X(INPUT_HELP) \
+    X(PATH_HELP) \
+    X(RECURSIVE_HELP) \
+    X(OUTPUT_HELP) \
+    X(HELP_HELP) \
+    X(VERSION_HELP) \
+    X(VERBOSE_HELP) \
+    X(TRY_HELP) \
+    X(CRITICAL_ERROR) \
+    X(A_POWERFUL_ROM_TRIMMING_UTILITY) \
+    X(FILES_PROCESSED) \
+    X(FILES_TRIMMED) \
+    X(FILES_FAILED) \
+    X(SPACE_RECOVERED) \
+    X(DETAILS_TITLE) \
+    X(ORIGINAL_SIZE) \
+    X(FINAL_SIZE) \
+    X(REDUCTION) \
+    X(ERROR_LABEL) \
+    X(EMPTY_FILE) \
+    X(AUTO_PADDING_DETECTED) \
+    X(UNSAFE_TRIM) \
+    X(WARNING_FORCING_TRIM) \
+    X(ANALYSIS) \
+    X(CAN_BE_REMOVED) \
+    X(SIMULATION_REMOVE) \
+    X(WRITE_FILE_ERROR) \
+    X(ERROR_PROCESSING) \
+    X(CANNOT_CREATE_OUTPUT) \
+    X(ERROR_WRITING) \
+    X(CANNOT_OPEN_FILE) \
+    X(ERROR_READING_FILE) \
+    X(PATH_NOT_EXIST) \
+    X(FILES_FOUND) \
+    X(BACKUP_EXISTS_OVERWRITING) \
+    X(BACKUP_CREATED) \
+    X(BACKUP_FAILED) \
+    X(FINAL_SIZE_BELOW_MIN) \
+    X(BELOW_MINIMUM_ALLOWED) \
+    X(CUT_TOO_AGGRESSIVE) \
+    X(EXCEEDS_LIMIT) \
+    X(FILE_TOO_SMALL_AFTER_TRIM) \
+    X(BELOW_SAFETY_MARGIN) \
+    X(GBA_VALIDATION_FAILED) \
+    X(NDS_VALIDATION_FAILED) \
+    X(GB_VALIDATION_FAILED) \
+    X(CUT_TOO_LARGE_UNKNOWN_ROM) \
+    X(CUT_INTERRUPTS_KNOWN_STRUCTURES) \
+    X(FORCE_HELP) \
+    X(EXAMPLE_TRIM_SINGLE) \
+    X(EXAMPLE_PROCESS_DIR) \
+    X(EXAMPLE_ANALYZE_ONLY) \
+    X(VERSION_TEXT) \
+    X(VALIDATION_OK) \
+    X(HIGH_RISK_OPERATION) \
+    X(VALIDATION_EXCEPTION) \
+    X(EMPTY_DATA) \
+    X(LARGE_CUT_WARNING) \
+    X(SUGGEST_FORCE_OR_ANALYZE) \
+    X(HEADER_INTEGRITY_COMPROMISED) \
+    X(SUGGEST_BACKUP_AND_VERIFY) \
+    X(RISK_LARGE_CUT) \
+    X(REZIP_STATISTICS) \
+    X(REZIP_ENABLED) \
+    X(RISK_BELOW_RECOMMENDED) \
+    X(RISK_STRUCTURE_CONFLICT) \
+    X(RECOMMENDATION_LOW_RISK) \
+    X(RECOMMENDATION_MEDIUM_RISK) \
+    X(RECOMMENDATION_HIGH_RISK) \
+    X(RECOMMENDATION_CRITICAL_RISK) \
+    X(INTERRUPT_RECEIVED) \
+    X(SEGMENTATION_FAULT) \
+    X(PLEASE_REPORT_BUG) \
+    X(TERMINATION_REQUESTED) \
+    X(LANGUAGE_SET) \
+    X(LANGUAGE_ERROR) \
+    X(FALLBACK_TO_ENGLISH) \
+    X(QUICK_EXAMPLES) \
+    X(TROUBLESHOOTING_TIPS) \
+    X(CHECK_PERMISSIONS) \
+    X(VERIFY_INPUT_FILES) \
+    X(TRY_DRY_RUN_FIRST) \
+    X(REPORT_ISSUE) \
+    X(NO_BACKUP_HELP) \
+    X(ARGUMENT_ERROR) \
+    X(INVALID_OUTPUT_DIR) \
+    X(HIGH_CUT_RATIO_WARNING) \
+    X(SUCCESSFULLY_TRIMMED) \
+    X(NO_CHANGES) \
+    X(SUPPORTED_FORMATS) \
+    X(SAFETY_NOTES) \
+    X(EXTENSIONS_HELP) \
+    X(COMPRESSED_HELP) \
+    X(EXTRACT_ONLY_HELP) \
+    X(EXTRACT_DIR_HELP) \
+    X(EXTRACTING_FILE) \
+    X(EXTRACTION_FAILED) \
+    X(EXTRACTION_SUCCESS) \
+    X(NO_EXTRACTION_TOOLS) \
+    X(UNKNOWN_ERROR) \
+    /* fim da lista */
+
+enum class TrKey : uint16_t {
+#define ROMTRIMMER_TR_ENUM(name) name,
+    ROMTRIMMER_TR_KEYS(ROMTRIMMER_TR_ENUM)
+#undef ROMTRIMMER_TR_ENUM
+    COUNT
+};
+
+constexpr size_t TR_KEY_COUNT = static_cast<size_t>(TrKey::COUNT);
+
+// Nomes na mesma ordem do enum (usados por getString em tempo de execução)
+constexpr std::string_view TR_KEY_NAMES[TR_KEY_COUNT] = {
+#define ROMTRIMMER_TR_NAME(name) #name,
+    ROMTRIMMER_TR_KEYS(ROMTRIMMER_TR_NAME)
+#undef ROMTRIMMER_TR_NAME
+};
+
+/**
+ * @brief Converte o nome da chave no seu índice
+ *
+ * Em contexto constante (TR_KEY) uma chave desconhecida chega ao throw e o
+ * compilador rejeita a expressão.
+ */
+constexpr TrKey trKeyFromName(std::string_view name) {
+    for (size_t i = 0; i < TR_KEY_COUNT; ++i) {
+        if (TR_KEY_NAMES[i] == name) {
+            return static_cast<TrKey>(i);
+        }
+    }
+    throw std::invalid_argument("Unknown translation key");
+}
+
+// Garante avaliação em tempo de compilação
+template <TrKey Key>
+struct TrKeyConstant {
+    static constexpr TrKey value = Key;
+};
+
+#define TR_KEY(key) (TrKeyConstant<trKeyFromName(key)>::value)
@@ -0,0 +1,91 @@
+#pragma once
+
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <cstdint>
+
+#include "RomDetector.hpp"
+#include "PaddingAnalyzer.hpp"
+#include "SafetyValidator.hpp"
+#include "TrimOptions.hpp"
+#include "MappedFile.hpp"
+
+namespace fs = std::filesystem;
+
+// Onde o pipeline parou (para quem precisa de códigos, ex.: API C)
+enum class TrimFailure {
+    NONE,
+    OPEN_FAILED,
+    READ_FAILED,
+    UNKNOWN_TYPE,
+    UNSAFE,
+    OUTPUT_EXISTS,   // saída separada já existe e não há --force
+    WRITE_FAILED
+};
+
+// Resultado estruturado de uma ROM (sem texto localizado)
+struct TrimReport {
+    fs::path path;
+    fs::path outputPath;
+    RomType romType = RomType::UNKNOWN;
+    uint8_t paddingByte = 0xFF;
+    size_t originalSize = 0;
+    size_t trimPoint = 0;
+    size_t headerSize = 0;   // header de copiadora antes do payload (SNES)
+    double confidence = 0.0;
+    bool hasPadding = false;
+    bool safe = false;
+    bool trimmed = false;
+    std::vector<std::string> warnings;
+    std::string error;
+    TrimFailure failure = TrimFailure::NONE;
+
+    bool ok() const { return error.empty(); }
+};
+
+/**
+ * @brief Pipeline detectar → padding → validar → (escrever) sem estado global.
+ *
+ * Não loga nem acumula estatísticas; quem chama decide o que fazer com o
+ * TrimReport. Os analisadores não guardam estado, então uma instância pode
+ * ser usada por várias threads ao mesmo tempo.
+ */
+class TrimEngine {
+public:
+    explicit TrimEngine(const TrimOptions& options);
+
+    // Só análise: nada é escrito
+    TrimReport analyze(const fs::path& file);
+    TrimReport analyzeData(std::string_view data);
+
+    // Análise + escrita. outputPath vazio = trim in-place
+    TrimReport trim(const fs::path& file, const fs::path& outputPath = {});
+
+    // Mesmo que acima sobre um arquivo já aberto (buffer do chamador).
+    // O mapeamento é fechado antes de truncar in-place.
+    TrimReport trim(MappedFile& input, const fs::path& outputPath = {});
+
+    // Escreve o corte de um analyzeData(input.view()) já feito, para quem
+    // precisou do relatório antes (ex.: hash do prefixo na mesma leitura).
+    // Único caminho de escrita: o CLI também grava por aqui
+    TrimReport commit(MappedFile& input, TrimReport report,
+                      const fs::path& outputPath = {});
+
+    const TrimOptions& getOptions() const { return options; }
+
+    // Extensões tratadas como ROM em lotes de diretório
+    static bool isRomExtension(const fs::path& file);
+
+private:
+    TrimOptions options;
+    RomDetector detector;
+    PaddingAnalyzer analyzer;
+    SafetyValidator validator;
+
+    void writeOutput(MappedFile& input, TrimReport& report);
+
+    // Pré-classificação pelo header: true = nem vale abrir o arquivo
+    bool rejectByHeader(const fs::path& file, TrimReport& report);
+};
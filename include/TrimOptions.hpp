@@ -32,6 +32,14 @@ struct TrimOptions {
     size_t safetyMargin  = 64 * 1024;
     double maxCutRatio   = 0.6;
 
+    // ==================== CONVERSÃO ====================
+    // Grava ROMs N64 .v64/.n64 na ordem .z64 (a dos DATs)
+    bool normalizeN64    = false;
+    // Grava ROMs SNES sem o header de copiadora de 512 bytes
+    bool stripCopierHeader = false;
+    // Mantém o tamanho lógico e só desaloca o padding 0x00 (punch hole)
+    bool sparse          = false;
+
     // ==================== CONFIGURAÇÕES DE SAÍDA ====================
     fs::path outputDir;
     std::vector<fs::path> inputPaths;
@@ -54,6 +62,9 @@ struct TrimOptions {
            << "  minSize: "          << minSize          << " bytes\n"
            << "  safetyMargin: "     << safetyMargin     << " bytes\n"
            << "  maxCutRatio: "      << (maxCutRatio * 100.0) << "%\n"
+           << "  normalizeN64: "     << normalizeN64     << "\n"
+           << "  stripCopierHeader: " << stripCopierHeader << "\n"
+           << "  sparse: "           << sparse           << "\n"
            << "  outputDir: "        << (outputDir.empty() ? "(none)" : outputDir.string()) << "\n"
            << "  inputPaths: "       << inputPaths.size() << " paths\n"
            << "}";
@@ -88,6 +99,15 @@ struct TrimOptions {
         if (maxCutRatio != 0.6)
             ss << " --max-cut-ratio " << maxCutRatio;
 
+        if (normalizeN64)
+            ss << " --normalize-n64";
+
+        if (stripCopierHeader)
+            ss << " --strip-copier-header";
+
+        if (sparse)
+            ss << " --sparse";
+
         if (!outputDir.empty())
             ss << " -o \"" << outputDir.string() << "\"";
 
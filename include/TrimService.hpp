@@ -0,0 +1,73 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <filesystem>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "DatCatalog.hpp"
+#include "DatIntegration.hpp"
+#include "Logger.hpp"
+#include "ThreadPool.hpp"
+#include "TrimEngine.hpp"
+
+namespace fs = std::filesystem;
+
+/**
+ * @brief Serviço residente num socket Unix (--serve).
+ *
+ * Protocolo de requisição: uma linha por comando, campos separados por TAB:
+ *
+ *     analyze<TAB>arquivo[<TAB>arquivo...]
+ *     trim<TAB>arquivo[<TAB>arquivo...]
+ *     verify<TAB>arquivo[<TAB>arquivo...]
+ *     ping
+ *     quit
+ *
+ * Caminhos com TAB ou quebra de linha não cabem no protocolo (o cliente
+ * deve recusá-los); um campo com outro caractere de controle faz a
+ * requisição inteira voltar com "error". O socket é criado com modo 0660.
+ *
+ * Respostas em NDJSON: um registro por arquivo assim que ele termina (em
+ * qualquer ordem), seguido de {"req":N,"done":true,...}. O pool de threads
+ * e o índice do DAT (--dat) ficam carregados entre requisições.
+ */
+class TrimService {
+public:
+    TrimService(const TrimOptions& options, Logger& logger, size_t threads);
+    ~TrimService();
+
+    // Carrega e indexa o DAT usado pelo comando verify
+    bool loadDat(const fs::path& datPath);
+
+    // Bloqueia atendendo clientes até stopRequested() retornar true
+    bool serve(const fs::path& socketPath, const std::function<bool()>& stopRequested);
+
+private:
+    struct Connection;
+
+    TrimOptions options;
+    Logger& logger;
+    TrimEngine engine;
+    ThreadPool pool;
+
+    // DAT do verify, em colunas com índices ordenados
+    DatCatalog catalog;
+
+    // Uma thread (destacada) por cliente; serve() espera todas saírem
+    std::atomic<bool> stopping{false};
+    size_t activeClients = 0;
+    std::mutex clientsMutex;
+    std::condition_variable clientsDone;
+
+    void handleClient(int fd);
+    void handleRequest(Connection& connection, const std::string& line);
+
+    // Executam no pool; enviam o registro e retornam se deu certo
+    bool runAnalyze(Connection& connection, size_t request,
+                    const std::string& op, const fs::path& file);
+    bool runVerify(Connection& connection, size_t request, const fs::path& file);
+};
@@ -107,6 +107,10 @@ std::string Ucon64Integration::detectConsoleForUcon64(RomType romType) {
         case RomType::NDS: return "--nds";
         case RomType::GB:  return "--gb";
         case RomType::GBC: return "--gbc";
+        case RomType::NES: return "--nes";
+        case RomType::SNES: return "--snes";
+        case RomType::N64: return "--n64";
+        case RomType::MEGADRIVE: return "--gen";
         default: return "";
     }
 }
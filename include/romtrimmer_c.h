@@ -18,7 +18,9 @@ typedef enum {
     RT_ERROR_READ_FAILED,
     RT_ERROR_WRITE_FAILED,
     RT_ERROR_UNSUPPORTED_FORMAT,
-    RT_ERROR_VALIDATION_FAILED
+    RT_ERROR_VALIDATION_FAILED,
+    RT_ERROR_IN_PROGRESS,       // rt_job_poll: job still running
+    RT_ERROR_CANCELLED          // job stopped by rt_job_cancel
 } rt_error_t;
 
 // ROM type
@@ -30,7 +32,8 @@ typedef enum {
     RT_ROM_GBC,
     RT_ROM_NES,
     RT_ROM_SNES,
-    RT_ROM_N64
+    RT_ROM_N64,
+    RT_ROM_MD                   // Mega Drive / Genesis
 } rt_rom_type_t;
 
 // Configuration
@@ -56,6 +59,55 @@ typedef struct {
     bool validation_passed;
 } rt_analysis_result_t;
 
+// Checksums as DATs list them (lowercase hex, NUL-terminated)
+typedef struct {
+    uint64_t size;
+    uint32_t crc32;
+    char md5[33];
+    char sha1[41];
+    char sha256[65];
+} rt_checksums_t;
+
+// Batch counters
+typedef struct {
+    size_t files_total;
+    size_t files_trimmed;
+    size_t files_skipped;   // not a recognized ROM
+    size_t files_failed;
+    size_t bytes_saved;
+} rt_batch_stats_t;
+
+// Reusable context: analyzers, read buffers and worker pool are kept
+// between calls. A context must not be used by two threads at once.
+typedef struct rt_context rt_context_t;
+
+// Asynchronous directory job (see rt_job_start)
+typedef struct rt_job rt_job_t;
+
+typedef enum {
+    RT_JOB_RUNNING = 0,
+    RT_JOB_FINISHED,
+    RT_JOB_CANCELLED
+} rt_job_state_t;
+
+// Snapshot of a job. files_total grows while the directory is still being
+// listed; files_done counts every file that went through the pipeline.
+typedef struct {
+    rt_job_state_t state;
+    rt_batch_stats_t stats;
+    size_t files_done;
+    size_t bytes_processed;     // input bytes read so far
+    double elapsed_seconds;
+    double files_per_second;
+    double bytes_per_second;
+} rt_job_progress_t;
+
+// Called once per finished file, from a worker thread. Must be thread-safe
+// and must not destroy the job; calling rt_job_cancel from it is allowed.
+typedef void (*rt_file_callback_t)(const char* filename, rt_error_t error,
+                                   const rt_analysis_result_t* result,
+                                   void* user_data);
+
 // Initialize/finalize
 rt_error_t rt_init();
 void rt_cleanup();
@@ -64,14 +116,55 @@ void rt_cleanup();
 void rt_set_default_config(rt_config_t* config);
 rt_error_t rt_load_config(const char* config_file);
 
-// Core functions
+// Context (config may be NULL for the defaults)
+rt_context_t* rt_context_create(const rt_config_t* config);
+void rt_context_destroy(rt_context_t* ctx);
+
+// Analyze a caller-owned buffer in place (no copy)
+rt_error_t rt_context_analyze_memory(rt_context_t* ctx, const uint8_t* data, size_t size,
+                                     rt_analysis_result_t* result);
+rt_error_t rt_context_analyze_file(rt_context_t* ctx, const char* filename,
+                                   rt_analysis_result_t* result);
+// output_file NULL or equal to input_file trims in place
+rt_error_t rt_context_trim_file(rt_context_t* ctx, const char* input_file,
+                                const char* output_file, rt_analysis_result_t* result);
+// threads = 0 uses every core; stats may be NULL
+rt_error_t rt_context_process_directory(rt_context_t* ctx, const char* directory,
+                                        bool recursive, unsigned threads,
+                                        rt_batch_stats_t* stats);
+
+// Jobs run rt_context_process_directory in the background. The context is
+// borrowed: it must outlive the job and must not be used until the job has
+// finished. Cancellation is cooperative: files already being trimmed are
+// completed, files not yet started are left untouched.
+rt_error_t rt_job_start(rt_context_t* ctx, const char* directory, bool recursive,
+                        unsigned threads, rt_file_callback_t callback,
+                        void* user_data, rt_job_t** job);
+// Non-blocking: RT_ERROR_IN_PROGRESS while running, otherwise the job result.
+// progress may be NULL.
+rt_error_t rt_job_poll(rt_job_t* job, rt_job_progress_t* progress);
+void rt_job_cancel(rt_job_t* job);
+// Blocks until the job ends and returns its result; progress may be NULL.
+rt_error_t rt_job_wait(rt_job_t* job, rt_job_progress_t* progress);
+// Cancels if still running, waits, then releases the handle
+void rt_job_destroy(rt_job_t* job);
+
+// Core functions (use the config from rt_init/rt_load_config)
 rt_error_t rt_analyze_file(const char* filename, rt_analysis_result_t* result);
 rt_error_t rt_trim_file(const char* input_file, const char* output_file, 
                         const rt_config_t* config, rt_analysis_result_t* result);
+// The trimmed ROM is always a prefix of `data`: pass trimmed_data = NULL to
+// only receive trimmed_size and skip the copy. Otherwise *trimmed_data is
+// allocated and must be released with rt_free().
 rt_error_t rt_trim_memory(const uint8_t* data, size_t size, 
                           uint8_t** trimmed_data, size_t* trimmed_size,
                           const rt_config_t* config);
 
+// Checksums. Files are hashed in DAT order: N64 .v64/.n64 as .z64 and
+// SNES without the copier header. Buffers are hashed as they are.
+rt_error_t rt_checksum_file(const char* filename, rt_checksums_t* result);
+rt_error_t rt_checksum_memory(const uint8_t* data, size_t size, rt_checksums_t* result);
+
 // Batch operations
 rt_error_t rt_process_directory(const char* directory, const rt_config_t* config,
                                 bool recursive);
@@ -111,7 +204,9 @@ typedef enum {
     RT_ERROR_READ_FAILED,
     RT_ERROR_WRITE_FAILED,
     RT_ERROR_UNSUPPORTED_FORMAT,
-    RT_ERROR_VALIDATION_FAILED
+    RT_ERROR_VALIDATION_FAILED,
+    RT_ERROR_IN_PROGRESS,       // rt_job_poll: job still running
+    RT_ERROR_CANCELLED          // job stopped by rt_job_cancel
 } rt_error_t;
 
 // ROM type
@@ -149,6 +244,46 @@ typedef struct {
     bool validation_passed;
 } rt_analysis_result_t;
 
+// Batch counters
+typedef struct {
+    size_t files_total;
+    size_t files_trimmed;
+    size_t files_skipped;   // not a recognized ROM
+    size_t files_failed;
+    size_t bytes_saved;
+} rt_batch_stats_t;
+
+// Reusable context: analyzers, read buffers and worker pool are kept
+// between calls. A context must not be used by two threads at once.
+typedef struct rt_context rt_context_t;
+
+// Asynchronous directory job (see rt_job_start)
+typedef struct rt_job rt_job_t;
+
+typedef enum {
+    RT_JOB_RUNNING = 0,
+    RT_JOB_FINISHED,
+    RT_JOB_CANCELLED
+} rt_job_state_t;
+
+// Snapshot of a job. files_total grows while the directory is still being
+// listed; files_done counts every file that went through the pipeline.
+typedef struct {
+    rt_job_state_t state;
+    rt_batch_stats_t stats;
+    size_t files_done;
+    size_t bytes_processed;     // input bytes read so far
+    double elapsed_seconds;
+    double files_per_second;
+    double bytes_per_second;
+} rt_job_progress_t;
+
+// Called once per finished file, from a worker thread. Must be thread-safe
+// and must not destroy the job; calling rt_job_cancel from it is allowed.
+typedef void (*rt_file_callback_t)(const char* filename, rt_error_t error,
+                                   const rt_analysis_result_t* result,
+                                   void* user_data);
+
 // Initialize/finalize
 rt_error_t rt_init();
 void rt_cleanup();
@@ -157,10 +292,46 @@ void rt_cleanup();
 void rt_set_default_config(rt_config_t* config);
 rt_error_t rt_load_config(const char* config_file);
 
-// Core functions
+// Context (config may be NULL for the defaults)
+rt_context_t* rt_context_create(const rt_config_t* config);
+void rt_context_destroy(rt_context_t* ctx);
+
+// Analyze a caller-owned buffer in place (no copy)
+rt_error_t rt_context_analyze_memory(rt_context_t* ctx, const uint8_t* data, size_t size,
+                                     rt_analysis_result_t* result);
+rt_error_t rt_context_analyze_file(rt_context_t* ctx, const char* filename,
+                                   rt_analysis_result_t* result);
+// output_file NULL or equal to input_file trims in place
+rt_error_t rt_context_trim_file(rt_context_t* ctx, const char* input_file,
+                                const char* output_file, rt_analysis_result_t* result);
+// threads = 0 uses every core; stats may be NULL
+rt_error_t rt_context_process_directory(rt_context_t* ctx, const char* directory,
+                                        bool recursive, unsigned threads,
+                                        rt_batch_stats_t* stats);
+
+// Jobs run rt_context_process_directory in the background. The context is
+// borrowed: it must outlive the job and must not be used until the job has
+// finished. Cancellation is cooperative: files already being trimmed are
+// completed, files not yet started are left untouched.
+rt_error_t rt_job_start(rt_context_t* ctx, const char* directory, bool recursive,
+                        unsigned threads, rt_file_callback_t callback,
+                        void* user_data, rt_job_t** job);
+// Non-blocking: RT_ERROR_IN_PROGRESS while running, otherwise the job result.
+// progress may be NULL.
+rt_error_t rt_job_poll(rt_job_t* job, rt_job_progress_t* progress);
+void rt_job_cancel(rt_job_t* job);
+// Blocks until the job ends and returns its result; progress may be NULL.
+rt_error_t rt_job_wait(rt_job_t* job, rt_job_progress_t* progress);
+// Cancels if still running, waits, then releases the handle
+void rt_job_destroy(rt_job_t* job);
+
+// Core functions (use the config from rt_init/rt_load_config)
 rt_error_t rt_analyze_file(const char* filename, rt_analysis_result_t* result);
 rt_error_t rt_trim_file(const char* input_file, const char* output_file, 
                         const rt_config_t* config, rt_analysis_result_t* result);
+// The trimmed ROM is always a prefix of `data`: pass trimmed_data = NULL to
+// only receive trimmed_size and skip the copy. Otherwise *trimmed_data is
+// allocated and must be released with rt_free().
 rt_error_t rt_trim_memory(const uint8_t* data, size_t size, 
                           uint8_t** trimmed_data, size_t* trimmed_size,
                           const rt_config_t* config);
@@ -0,0 +1,407 @@
+// romtrimmer_module.cpp - CPython extension over the core library
+//
+// ROM data is taken through the buffer protocol (bytes, bytearray,
+// memoryview, mmap, numpy arrays...) and analyzed in place; str and
+// os.PathLike arguments are file paths. Work runs with the GIL released.
+#define PY_SSIZE_T_CLEAN
+#include <Python.h>
+
+#include "TrimEngine.hpp"
+#include "ThreadPool.hpp"
+#include "Version.hpp"
+
+#include <algorithm>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+// ==================== INPUT ====================
+
+// One ROM argument: a borrowed buffer or a path. Must be destroyed with
+// the GIL held (PyBuffer_Release).
+struct Source {
+    Py_buffer buffer{};
+    bool hasBuffer = false;
+    fs::path path;
+
+    Source() = default;
+    Source(const Source&) = delete;
+    Source& operator=(const Source&) = delete;
+    Source(Source&& other) noexcept
+        : buffer(other.buffer), hasBuffer(other.hasBuffer), path(std::move(other.path)) {
+        other.hasBuffer = false;
+    }
+    ~Source() {
+        if (hasBuffer) PyBuffer_Release(&buffer);
+    }
+
+    std::string_view view() const {
+        return {static_cast<const char*>(buffer.buf), static_cast<size_t>(buffer.len)};
+    }
+};
+
+bool toSource(PyObject* object, Source& source) {
+    if (PyObject_CheckBuffer(object)) {
+        if (PyObject_GetBuffer(object, &source.buffer, PyBUF_SIMPLE) < 0) return false;
+        source.hasBuffer = true;
+        return true;
+    }
+
+    PyObject* encoded = nullptr;
+    if (!PyUnicode_FSConverter(object, &encoded)) return false;
+    source.path = fs::path(PyBytes_AS_STRING(encoded));
+    Py_DECREF(encoded);
+    return true;
+}
+
+struct CallOptions {
+    TrimOptions trim;
+    unsigned threads = 0;
+};
+
+bool readBool(PyObject* value, bool& out) {
+    int truth = PyObject_IsTrue(value);
+    if (truth < 0) return false;
+    out = truth != 0;
+    return true;
+}
+
+bool readSize(PyObject* value, size_t& out) {
+    size_t number = PyLong_AsSize_t(value);
+    if (number == static_cast<size_t>(-1) && PyErr_Occurred()) return false;
+    out = number;
+    return true;
+}
+
+// Keyword options shared by every entry point. padding=None (or 0, as in
+// the CLI) means auto-detect.
+bool parseOptions(PyObject* kwargs, CallOptions& out, bool allowThreads) {
+    out.trim.paddingByte = 0;
+    if (!kwargs) return true;
+
+    PyObject* key;
+    PyObject* value;
+    Py_ssize_t position = 0;
+    while (PyDict_Next(kwargs, &position, &key, &value)) {
+        const char* name = PyUnicode_AsUTF8(key);
+        if (!name) return false;
+        std::string_view option(name);
+
+        if (option == "padding") {
+            if (value == Py_None) {
+                out.trim.paddingByte = 0;
+                continue;
+            }
+            long byte = PyLong_AsLong(value);
+            if (byte == -1 && PyErr_Occurred()) return false;
+            if (byte < 0 || byte > 0xFF) {
+                PyErr_SetString(PyExc_ValueError, "padding must be None or 0..255");
+                return false;
+            }
+            out.trim.paddingByte = static_cast<uint8_t>(byte);
+        } else if (option == "force") {
+            if (!readBool(value, out.trim.force)) return false;
+        } else if (option == "backup") {
+            if (!readBool(value, out.trim.backup)) return false;
+        } else if (option == "min_size") {
+            if (!readSize(value, out.trim.minSize)) return false;
+        } else if (option == "safety_margin") {
+            if (!readSize(value, out.trim.safetyMargin)) return false;
+        } else if (option == "max_cut_ratio") {
+            out.trim.maxCutRatio = PyFloat_AsDouble(value);
+            if (PyErr_Occurred()) return false;
+        } else if (option == "threads" && allowThreads) {
+            size_t threads = 0;
+            if (!readSize(value, threads)) return false;
+            out.threads = static_cast<unsigned>(threads);
+        } else {
+            PyErr_Format(PyExc_TypeError, "unexpected keyword argument '%s'", name);
+            return false;
+        }
+    }
+    return true;
+}
+
+// ==================== WORK (GIL released) ====================
+
+TrimReport runOne(TrimEngine& engine, const Source& source, bool trim, const fs::path& output) {
+    try {
+        if (source.hasBuffer) return engine.analyzeData(source.view());
+        return trim ? engine.trim(source.path, output) : engine.analyze(source.path);
+    } catch (const std::exception& e) {
+        TrimReport report;
+        report.path = source.path;
+        report.error = e.what();
+        report.failure = TrimFailure::READ_FAILED;
+        return report;
+    }
+}
+
+std::mutex g_poolMutex;
+std::shared_ptr<ThreadPool> g_pool;
+
+// Batches keep their own reference, so resizing never pulls a pool out
+// from under a batch running on another Python thread.
+std::shared_ptr<ThreadPool> sharedPool(unsigned threads) {
+    size_t workers = threads ? threads : std::max(1u, std::thread::hardware_concurrency());
+    std::lock_guard<std::mutex> lock(g_poolMutex);
+    if (!g_pool || g_pool->size() != workers) {
+        g_pool = std::make_shared<ThreadPool>(workers);
+    }
+    return g_pool;
+}
+
+// ==================== OUTPUT ====================
+
+const char* failureName(TrimFailure failure) {
+    switch (failure) {
+        case TrimFailure::NONE:          return "none";
+        case TrimFailure::OPEN_FAILED:   return "open_failed";
+        case TrimFailure::READ_FAILED:   return "read_failed";
+        case TrimFailure::UNKNOWN_TYPE:  return "unknown_type";
+        case TrimFailure::UNSAFE:        return "unsafe";
+        case TrimFailure::OUTPUT_EXISTS: return "output_exists";
+        case TrimFailure::WRITE_FAILED:  return "write_failed";
+    }
+    // Sem default no switch: -Wswitch aponta valor novo sem nome aqui
+    return "unknown";
+}
+
+PyObject* text(const std::string& value) {
+    return PyUnicode_DecodeUTF8(value.data(), static_cast<Py_ssize_t>(value.size()), "replace");
+}
+
+PyObject* none() {
+    Py_RETURN_NONE;
+}
+
+PyObject* pathOrNone(const fs::path& path) {
+    if (path.empty()) return none();
+    return PyUnicode_DecodeFSDefault(path.c_str());
+}
+
+// Steals `value`; false if it (or the insertion) failed
+bool setItem(PyObject* dict, const char* key, PyObject* value) {
+    if (!value) return false;
+    int status = PyDict_SetItemString(dict, key, value);
+    Py_DECREF(value);
+    return status == 0;
+}
+
+// Zero-copy view of the bytes kept by the trim
+PyObject* trimmedView(PyObject* object, size_t trimPoint) {
+    PyObject* view = PyMemoryView_FromObject(object);
+    if (!view) return nullptr;
+    PyObject* bytes = PyObject_CallMethod(view, "cast", "s", "B");
+    Py_DECREF(view);
+    if (!bytes) return nullptr;
+    PyObject* prefix = PySequence_GetSlice(bytes, 0, static_cast<Py_ssize_t>(trimPoint));
+    Py_DECREF(bytes);
+    return prefix;
+}
+
+PyObject* reportToDict(const TrimReport& report, PyObject* bufferObject, bool trim) {
+    PyObject* dict = PyDict_New();
+    if (!dict) return nullptr;
+
+    PyObject* warnings = PyList_New(0);
+    for (const auto& warning : report.warnings) {
+        if (!warnings) break;
+        PyObject* item = text(warning);
+        if (!item || PyList_Append(warnings, item) < 0) {
+            Py_XDECREF(item);
+            Py_CLEAR(warnings);
+            break;
+        }
+        Py_DECREF(item);
+    }
+
+    bool ok = setItem(dict, "warnings", warnings) &&
+              setItem(dict, "path", pathOrNone(report.path)) &&
+              setItem(dict, "output_path", pathOrNone(report.outputPath)) &&
+              setItem(dict, "rom_type", PyUnicode_FromString(romTypeName(report.romType))) &&
+              setItem(dict, "padding_byte", PyLong_FromLong(report.paddingByte)) &&
+              setItem(dict, "original_size", PyLong_FromSize_t(report.originalSize)) &&
+              setItem(dict, "trimmed_size", PyLong_FromSize_t(report.trimPoint)) &&
+              setItem(dict, "saved_bytes", PyLong_FromSize_t(report.originalSize - report.trimPoint)) &&
+              setItem(dict, "confidence", PyFloat_FromDouble(report.confidence)) &&
+              setItem(dict, "has_padding", PyBool_FromLong(report.hasPadding)) &&
+              setItem(dict, "safe", PyBool_FromLong(report.safe)) &&
+              setItem(dict, "trimmed", PyBool_FromLong(report.trimmed)) &&
+              setItem(dict, "error", report.ok() ? none() : text(report.error)) &&
+              setItem(dict, "failure", PyUnicode_FromString(failureName(report.failure)));
+
+    // Buffer trims never touch the caller's memory: hand back the kept prefix
+    if (ok && trim && bufferObject && report.ok()) {
+        ok = setItem(dict, "data", trimmedView(bufferObject, report.trimPoint));
+    }
+
+    if (!ok) {
+        Py_DECREF(dict);
+        return nullptr;
+    }
+    return dict;
+}
+
+// ==================== ENTRY POINTS ====================
+
+PyObject* runSingle(PyObject* object, PyObject* outputObject, PyObject* kwargs, bool trim) {
+    CallOptions options;
+    if (!parseOptions(kwargs, options, false)) return nullptr;
+
+    Source source;
+    if (!toSource(object, source)) return nullptr;
+
+    fs::path output;
+    if (outputObject && outputObject != Py_None) {
+        if (source.hasBuffer) {
+            PyErr_SetString(PyExc_TypeError, "output requires a path source");
+            return nullptr;
+        }
+        PyObject* encoded = nullptr;
+        if (!PyUnicode_FSConverter(outputObject, &encoded)) return nullptr;
+        output = fs::path(PyBytes_AS_STRING(encoded));
+        Py_DECREF(encoded);
+    }
+
+    TrimReport report;
+    Py_BEGIN_ALLOW_THREADS
+    TrimEngine engine(options.trim);
+    report = runOne(engine, source, trim, output);
+    Py_END_ALLOW_THREADS
+
+    return reportToDict(report, source.hasBuffer ? object : nullptr, trim);
+}
+
+PyObject* runBatch(PyObject* items, PyObject* kwargs, bool trim) {
+    CallOptions options;
+    if (!parseOptions(kwargs, options, true)) return nullptr;
+
+    PyObject* sequence = PySequence_Fast(items, "items must be iterable");
+    if (!sequence) return nullptr;
+
+    Py_ssize_t count = PySequence_Fast_GET_SIZE(sequence);
+    std::vector<Source> sources(static_cast<size_t>(count));
+    for (Py_ssize_t i = 0; i < count; ++i) {
+        if (!toSource(PySequence_Fast_GET_ITEM(sequence, i), sources[i])) {
+            Py_DECREF(sequence);
+            return nullptr;
+        }
+    }
+
+    std::vector<TrimReport> reports(sources.size());
+    std::string failure;
+
+    Py_BEGIN_ALLOW_THREADS
+    try {
+        TrimEngine engine(options.trim);
+        std::shared_ptr<ThreadPool> pool = sharedPool(options.threads);
+
+        std::vector<std::future<void>> pending;
+        pending.reserve(sources.size());
+        for (size_t i = 0; i < sources.size(); ++i) {
+            pending.push_back(pool->enqueue([&, i]() {
+                reports[i] = runOne(engine, sources[i], trim, {});
+            }));
+        }
+        for (auto& task : pending) {
+            task.wait();
+        }
+    } catch (const std::exception& e) {
+        failure = e.what();
+    }
+    Py_END_ALLOW_THREADS
+
+    if (!failure.empty()) {
+        Py_DECREF(sequence);
+        PyErr_SetString(PyExc_RuntimeError, failure.c_str());
+        return nullptr;
+    }
+
+    PyObject* results = PyList_New(count);
+    for (Py_ssize_t i = 0; results && i < count; ++i) {
+        PyObject* object = sources[i].hasBuffer ? PySequence_Fast_GET_ITEM(sequence, i) : nullptr;
+        PyObject* dict = reportToDict(reports[i], object, trim);
+        if (!dict) {
+            Py_CLEAR(results);
+            break;
+        }
+        PyList_SET_ITEM(results, i, dict);
+    }
+
+    sources.clear();  // releases buffers before the sequence goes away
+    Py_DECREF(sequence);
+    return results;
+}
+
+PyObject* py_analyze(PyObject*, PyObject* args, PyObject* kwargs) {
+    PyObject* object;
+    if (!PyArg_ParseTuple(args, "O:analyze", &object)) return nullptr;
+    return runSingle(object, nullptr, kwargs, false);
+}
+
+PyObject* py_trim(PyObject*, PyObject* args, PyObject* kwargs) {
+    PyObject* object;
+    PyObject* output = Py_None;
+    if (!PyArg_ParseTuple(args, "O|O:trim", &object, &output)) return nullptr;
+    return runSingle(object, output, kwargs, true);
+}
+
+PyObject* py_analyze_batch(PyObject*, PyObject* args, PyObject* kwargs) {
+    PyObject* items;
+    if (!PyArg_ParseTuple(args, "O:analyze_batch", &items)) return nullptr;
+    return runBatch(items, kwargs, false);
+}
+
+PyObject* py_trim_batch(PyObject*, PyObject* args, PyObject* kwargs) {
+    PyObject* items;
+    if (!PyArg_ParseTuple(args, "O:trim_batch", &items)) return nullptr;
+    return runBatch(items, kwargs, true);
+}
+
+PyMethodDef methods[] = {
+    {"analyze", reinterpret_cast<PyCFunction>(reinterpret_cast<void (*)()>(py_analyze)),
+     METH_VARARGS | METH_KEYWORDS,
+     "analyze(source, /, **options) -> dict\n\n"
+     "source is ROM data (any buffer, analyzed in place) or a path (str/PathLike)."},
+    {"trim", reinterpret_cast<PyCFunction>(reinterpret_cast<void (*)()>(py_trim)),
+     METH_VARARGS | METH_KEYWORDS,
+     "trim(source, output=None, /, **options) -> dict\n\n"
+     "Paths are trimmed in place unless output is given. Buffers are left\n"
+     "untouched; the result's 'data' is a memoryview of the kept prefix."},
+    {"analyze_batch", reinterpret_cast<PyCFunction>(reinterpret_cast<void (*)()>(py_analyze_batch)),
+     METH_VARARGS | METH_KEYWORDS,
+     "analyze_batch(items, /, threads=0, **options) -> list[dict]\n\n"
+     "Analyzes every item on the internal thread pool, in input order."},
+    {"trim_batch", reinterpret_cast<PyCFunction>(reinterpret_cast<void (*)()>(py_trim_batch)),
+     METH_VARARGS | METH_KEYWORDS,
+     "trim_batch(items, /, threads=0, **options) -> list[dict]\n\n"
+     "Same as trim() for every item, on the internal thread pool."},
+    {nullptr, nullptr, 0, nullptr}
+};
+
+PyModuleDef moduleDef = {
+    PyModuleDef_HEAD_INIT,
+    "romtrimmer",
+    "In-process bindings for RomTrimmer++.\n\n"
+    "Options: padding (None = auto), force, backup, min_size,\n"
+    "safety_margin, max_cut_ratio.",
+    -1,
+    methods,
+    nullptr, nullptr, nullptr, nullptr
+};
+
+} // namespace
+
+PyMODINIT_FUNC PyInit_romtrimmer() {
+    PyObject* module = PyModule_Create(&moduleDef);
+    if (module && PyModule_AddStringConstant(module, "__version__", ROMTRIMMER_VERSION_STRING) < 0) {
+        Py_CLEAR(module);
+    }
+    return module;
+}
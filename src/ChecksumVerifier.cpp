@@ -0,0 +1,413 @@
+#include "ChecksumVerifier.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <cstdio>
+#include <cstring>
+#include <regex>
+#include <stdexcept>
+#include <vector>
+
+#include <openssl/evp.h>
+#include <zlib.h>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+    #include <immintrin.h>
+    #define ROMTRIMMER_X86_DISPATCH 1
+#endif
+
+namespace {
+
+// ==================== CRC32 ESCALAR (SLICE-BY-16) ====================
+// Polinômio refletido 0xEDB88320 (o mesmo da zlib e dos DATs).
+
+struct Crc32Tables {
+    uint32_t t[16][256];
+
+    Crc32Tables() {
+        for (uint32_t i = 0; i < 256; ++i) {
+            uint32_t c = i;
+            for (int k = 0; k < 8; ++k) {
+                c = (c & 1) ? (c >> 1) ^ 0xEDB88320u : c >> 1;
+            }
+            t[0][i] = c;
+        }
+        for (int s = 1; s < 16; ++s) {
+            for (uint32_t i = 0; i < 256; ++i) {
+                t[s][i] = (t[s - 1][i] >> 8) ^ t[0][t[s - 1][i] & 0xFF];
+            }
+        }
+    }
+};
+
+const Crc32Tables& crcTables() {
+    static const Crc32Tables tables;
+    return tables;
+}
+
+inline uint32_t load32le(const uint8_t* p) {
+    return uint32_t(p[0]) | (uint32_t(p[1]) << 8) |
+           (uint32_t(p[2]) << 16) | (uint32_t(p[3]) << 24);
+}
+
+// c já invertido (estado interno), como os kernels abaixo
+uint32_t crc32SliceBy16(uint32_t c, const uint8_t* p, size_t len) {
+    const auto& t = crcTables().t;
+
+    while (len >= 16) {
+        uint32_t a = load32le(p) ^ c;
+        uint32_t b = load32le(p + 4);
+        uint32_t d = load32le(p + 8);
+        uint32_t e = load32le(p + 12);
+        c = t[15][a & 0xFF] ^ t[14][(a >> 8) & 0xFF] ^
+            t[13][(a >> 16) & 0xFF] ^ t[12][a >> 24] ^
+            t[11][b & 0xFF] ^ t[10][(b >> 8) & 0xFF] ^
+            t[9][(b >> 16) & 0xFF] ^ t[8][b >> 24] ^
+            t[7][d & 0xFF] ^ t[6][(d >> 8) & 0xFF] ^
+            t[5][(d >> 16) & 0xFF] ^ t[4][d >> 24] ^
+            t[3][e & 0xFF] ^ t[2][(e >> 8) & 0xFF] ^
+            t[1][(e >> 16) & 0xFF] ^ t[0][e >> 24];
+        p += 16;
+        len -= 16;
+    }
+    while (len--) {
+        c = (c >> 8) ^ t[0][(c ^ *p++) & 0xFF];
+    }
+    return c;
+}
+
+#ifdef ROMTRIMMER_X86_DISPATCH
+
+// ==================== CRC32 PCLMULQDQ ====================
+// Dobra de 4x128 bits com multiplicação sem carry e redução de Barrett
+// ("Fast CRC Computation for Generic Polynomials Using PCLMULQDQ", Intel).
+// Pede len >= 64 e múltiplo de 16; c já invertido.
+
+// Um passo de dobra: acc * k (metades baixa e alta) + próximo bloco
+__attribute__((target("pclmul,sse4.1")))
+inline __m128i foldBlock(__m128i acc, __m128i k, __m128i next) {
+    __m128i lo = _mm_clmulepi64_si128(acc, k, 0x00);
+    __m128i hi = _mm_clmulepi64_si128(acc, k, 0x11);
+    return _mm_xor_si128(_mm_xor_si128(hi, next), lo);
+}
+
+__attribute__((target("pclmul,sse4.1")))
+uint32_t crc32Pclmul(uint32_t c, const uint8_t* p, size_t len) {
+    alignas(16) static const uint64_t k1k2[] = {0x0154442bd4, 0x01c6e41596};
+    alignas(16) static const uint64_t k3k4[] = {0x01751997d0, 0x00ccaa009e};
+    alignas(16) static const uint64_t k5k0[] = {0x0163cd6124, 0x0000000000};
+    alignas(16) static const uint64_t poly[] = {0x01db710641, 0x01f7011641};
+
+    auto load = [](const uint8_t* q) {
+        return _mm_loadu_si128(reinterpret_cast<const __m128i*>(q));
+    };
+
+    __m128i x1 = load(p);
+    __m128i x2 = load(p + 16);
+    __m128i x3 = load(p + 32);
+    __m128i x4 = load(p + 48);
+    x1 = _mm_xor_si128(x1, _mm_cvtsi32_si128(static_cast<int>(c)));
+
+    __m128i k = _mm_load_si128(reinterpret_cast<const __m128i*>(k1k2));
+    p += 64;
+    len -= 64;
+
+    // Quatro acumuladores independentes: esconde a latência do pclmul
+    while (len >= 64) {
+        x1 = foldBlock(x1, k, load(p));
+        x2 = foldBlock(x2, k, load(p + 16));
+        x3 = foldBlock(x3, k, load(p + 32));
+        x4 = foldBlock(x4, k, load(p + 48));
+
+        p += 64;
+        len -= 64;
+    }
+
+    // 512 -> 128 bits
+    k = _mm_load_si128(reinterpret_cast<const __m128i*>(k3k4));
+    x1 = foldBlock(x1, k, x2);
+    x1 = foldBlock(x1, k, x3);
+    x1 = foldBlock(x1, k, x4);
+
+    while (len >= 16) {
+        x1 = foldBlock(x1, k, load(p));
+        p += 16;
+        len -= 16;
+    }
+
+    // 128 -> 64 bits
+    __m128i mask = _mm_setr_epi32(~0, 0, ~0, 0);
+    x2 = _mm_clmulepi64_si128(x1, k, 0x10);
+    x1 = _mm_xor_si128(_mm_srli_si128(x1, 8), x2);
+
+    k = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(k5k0));
+    x2 = _mm_srli_si128(x1, 4);
+    x1 = _mm_and_si128(x1, mask);
+    x1 = _mm_clmulepi64_si128(x1, k, 0x00);
+    x1 = _mm_xor_si128(x1, x2);
+
+    // Barrett: 64 -> 32 bits
+    k = _mm_load_si128(reinterpret_cast<const __m128i*>(poly));
+    x2 = _mm_and_si128(x1, mask);
+    x2 = _mm_clmulepi64_si128(x2, k, 0x10);
+    x2 = _mm_and_si128(x2, mask);
+    x2 = _mm_clmulepi64_si128(x2, k, 0x00);
+    x1 = _mm_xor_si128(x1, x2);
+
+    return static_cast<uint32_t>(_mm_extract_epi32(x1, 1));
+}
+
+bool cpuHasPclmul() {
+    static const bool supported = __builtin_cpu_supports("pclmul") &&
+                                  __builtin_cpu_supports("sse4.1");
+    return supported;
+}
+
+#endif
+
+// ==================== EVP ====================
+
+std::string hexString(const uint8_t* bytes, size_t length) {
+    static const char hex[] = "0123456789abcdef";
+    std::string out(length * 2, '0');
+    for (size_t i = 0; i < length; ++i) {
+        out[2 * i] = hex[bytes[i] >> 4];
+        out[2 * i + 1] = hex[bytes[i] & 0x0F];
+    }
+    return out;
+}
+
+EVP_MD_CTX* copyDigest(const EVP_MD_CTX* source) {
+    if (!source) {
+        return nullptr;
+    }
+    EVP_MD_CTX* ctx = EVP_MD_CTX_new();
+    if (!ctx || EVP_MD_CTX_copy_ex(ctx, source) != 1) {
+        EVP_MD_CTX_free(ctx);
+        throw std::runtime_error("Falha ao copiar digest OpenSSL");
+    }
+    return ctx;
+}
+
+EVP_MD_CTX* newDigest(const EVP_MD* type) {
+    EVP_MD_CTX* ctx = EVP_MD_CTX_new();
+    if (!ctx || EVP_DigestInit_ex(ctx, type, nullptr) != 1) {
+        EVP_MD_CTX_free(ctx);
+        throw std::runtime_error("Falha ao iniciar digest OpenSSL");
+    }
+    return ctx;
+}
+
+std::string finishDigest(EVP_MD_CTX* ctx) {
+    unsigned char digest[EVP_MAX_MD_SIZE];
+    unsigned int length = 0;
+    if (EVP_DigestFinal_ex(ctx, digest, &length) != 1) {
+        throw std::runtime_error("Falha ao finalizar digest OpenSSL");
+    }
+    return hexString(digest, length);
+}
+
+template <size_t N>
+std::array<uint8_t, N> oneShotDigest(const EVP_MD* type, const std::string& data) {
+    std::array<uint8_t, N> out{};
+    unsigned int length = 0;
+    if (EVP_Digest(data.data(), data.size(), out.data(), &length, type, nullptr) != 1 ||
+        length != N) {
+        throw std::runtime_error("Falha ao calcular digest OpenSSL");
+    }
+    return out;
+}
+
+std::string crcToHex(uint32_t crc) {
+    char buffer[9];
+    std::snprintf(buffer, sizeof(buffer), "%08x", crc);
+    return buffer;
+}
+
+std::string toLower(std::string s) {
+    std::transform(s.begin(), s.end(), s.begin(),
+                   [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+    return s;
+}
+
+} // namespace
+
+// ==================== CRC32 ====================
+
+uint32_t ChecksumVerifier::crc32Update(uint32_t crc, const void* data, size_t length) {
+    const uint8_t* p = static_cast<const uint8_t*>(data);
+    uint32_t c = ~crc;
+
+#ifdef ROMTRIMMER_X86_DISPATCH
+    if (length >= 64 && cpuHasPclmul()) {
+        size_t bulk = length & ~size_t(15);
+        c = crc32Pclmul(c, p, bulk);
+        p += bulk;
+        length -= bulk;
+    }
+#endif
+
+    return ~crc32SliceBy16(c, p, length);
+}
+
+uint32_t ChecksumVerifier::crc32Combine(uint32_t crcA, uint32_t crcB, uint64_t lengthB) {
+    return static_cast<uint32_t>(crc32_combine(crcA, crcB, static_cast<z_off_t>(lengthB)));
+}
+
+uint32_t ChecksumVerifier::crc32Run(uint8_t value, uint64_t count) {
+    // Quadrados sucessivos: piece cobre pieceLength bytes (1, 2, 4, ...)
+    uint32_t result = 0;
+    uint32_t piece = crc32Update(0, &value, 1);
+    uint64_t pieceLength = 1;
+
+    while (count > 0) {
+        if (count & 1) {
+            result = crc32Combine(result, piece, pieceLength);
+        }
+        count >>= 1;
+        if (count > 0) {
+            piece = crc32Combine(piece, piece, pieceLength);
+            pieceLength *= 2;
+        }
+    }
+    return result;
+}
+
+// ==================== STREAM ====================
+
+ChecksumVerifier::Stream::Stream(bool withSha256) {
+    try {
+        md5 = newDigest(EVP_md5());
+        sha1 = newDigest(EVP_sha1());
+        if (withSha256) {
+            sha256 = newDigest(EVP_sha256());
+        }
+    } catch (...) {
+        EVP_MD_CTX_free(md5);
+        EVP_MD_CTX_free(sha1);
+        throw;
+    }
+}
+
+ChecksumVerifier::Stream::Stream(const Stream& other)
+    : crc(other.crc), size(other.size) {
+    try {
+        md5 = copyDigest(other.md5);
+        sha1 = copyDigest(other.sha1);
+        sha256 = copyDigest(other.sha256);
+    } catch (...) {
+        EVP_MD_CTX_free(md5);
+        EVP_MD_CTX_free(sha1);
+        throw;
+    }
+}
+
+ChecksumVerifier::Stream::~Stream() {
+    EVP_MD_CTX_free(md5);
+    EVP_MD_CTX_free(sha1);
+    EVP_MD_CTX_free(sha256);
+}
+
+void ChecksumVerifier::Stream::update(const void* data, size_t length) {
+    crc = crc32Update(crc, data, length);
+    size += length;
+    EVP_DigestUpdate(md5, data, length);
+    EVP_DigestUpdate(sha1, data, length);
+    if (sha256) {
+        EVP_DigestUpdate(sha256, data, length);
+    }
+}
+
+void ChecksumVerifier::Stream::updateRun(uint8_t value, uint64_t count) {
+    crc = crc32Combine(crc, crc32Run(value, count), count);
+    size += count;
+
+    // MD5/SHA não têm atalho: os bytes passam, mas saem da cache, não do disco
+    std::vector<uint8_t> block(static_cast<size_t>(std::min<uint64_t>(count, 64 * 1024)), value);
+    while (count > 0) {
+        size_t length = static_cast<size_t>(std::min<uint64_t>(count, block.size()));
+        EVP_DigestUpdate(md5, block.data(), length);
+        EVP_DigestUpdate(sha1, block.data(), length);
+        if (sha256) {
+            EVP_DigestUpdate(sha256, block.data(), length);
+        }
+        count -= length;
+    }
+}
+
+ChecksumVerifier::Digests ChecksumVerifier::Stream::finish() {
+    Digests result;
+    result.size = size;
+    result.crc32 = crc;
+    result.crc32Hex = crcToHex(crc);
+    result.md5 = finishDigest(md5);
+    result.sha1 = finishDigest(sha1);
+    if (sha256) {
+        result.sha256 = finishDigest(sha256);
+    }
+    return result;
+}
+
+// ==================== API DE ALTO NÍVEL ====================
+
+std::string ChecksumVerifier::calculate(const std::string& data, ChecksumType type) {
+    switch (type) {
+        case ChecksumType::CRC32:
+            return crcToHex(calculateCRC32(data));
+        case ChecksumType::MD5: {
+            auto digest = calculateMD5(data);
+            return bytesToHex(digest.data(), digest.size());
+        }
+        case ChecksumType::SHA1: {
+            auto digest = calculateSHA1(data);
+            return bytesToHex(digest.data(), digest.size());
+        }
+        case ChecksumType::SHA256: {
+            auto digest = calculateSHA256(data);
+            return bytesToHex(digest.data(), digest.size());
+        }
+    }
+    return {};
+}
+
+ChecksumVerifier::ChecksumResult ChecksumVerifier::verify(const std::string& data,
+                                                          const std::string& expected,
+                                                          ChecksumType type) {
+    ChecksumResult result;
+    result.type = type;
+    result.expected = toLower(expected);
+    result.actual = calculate(data, type);
+    result.valid = result.actual == result.expected;
+    return result;
+}
+
+bool ChecksumVerifier::verifyAgainstDatabase(const std::string& filename,
+                                             const std::string& data) {
+    // Sem DAT carregado: o único "banco" disponível é o CRC no nome
+    static const std::regex crcTag(R"(\[([0-9A-Fa-f]{8})\])");
+    std::smatch match;
+    if (!std::regex_search(filename, match, crcTag)) {
+        return false;
+    }
+    return verify(data, match[1].str(), ChecksumType::CRC32).valid;
+}
+
+std::array<uint8_t, 16> ChecksumVerifier::calculateMD5(const std::string& data) {
+    return oneShotDigest<16>(EVP_md5(), data);
+}
+
+std::array<uint8_t, 20> ChecksumVerifier::calculateSHA1(const std::string& data) {
+    return oneShotDigest<20>(EVP_sha1(), data);
+}
+
+std::array<uint8_t, 32> ChecksumVerifier::calculateSHA256(const std::string& data) {
+    return oneShotDigest<32>(EVP_sha256(), data);
+}
+
+uint32_t ChecksumVerifier::calculateCRC32(const std::string& data) {
+    return crc32Update(0, data.data(), data.size());
+}
+
+std::string ChecksumVerifier::bytesToHex(const uint8_t* bytes, size_t length) {
+    return hexString(bytes, length);
+}
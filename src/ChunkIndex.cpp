@@ -0,0 +1,487 @@
+#include "ChunkIndex.hpp"
+#include "MappedFile.hpp"
+#include "ThreadPool.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <future>
+#include <map>
+#include <stdexcept>
+#include <unordered_set>
+
+#include <openssl/evp.h>
+
+namespace {
+    // Tabela do gear hash: 256 valores fixos de 64 bits (splitmix64), os
+    // mesmos em qualquer build para que os cortes sejam reproduzíveis
+    constexpr std::array<uint64_t, 256> makeGearTable() {
+        std::array<uint64_t, 256> table{};
+        uint64_t state = 0x5254524D43444331ULL;   // "RTRMCDC1"
+        for (auto& value : table) {
+            state += 0x9E3779B97F4A7C15ULL;
+            uint64_t z = state;
+            z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+            z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+            value = z ^ (z >> 31);
+        }
+        return table;
+    }
+
+    constexpr std::array<uint64_t, 256> GEAR = makeGearTable();
+
+    // O shift empurra os bytes recentes para cima: a máscara fica nos bits
+    // altos, que dependem da janela toda (64 bytes)
+    uint64_t topBits(unsigned count) {
+        return count == 0 ? 0 : ~0ULL << (64 - count);
+    }
+
+    unsigned log2Floor(uint32_t value) {
+        unsigned bits = 0;
+        while (value >>= 1) {
+            ++bits;
+        }
+        return bits;
+    }
+
+    using Fingerprint = std::array<uint8_t, 20>;
+
+    Fingerprint sha1Of(const void* data, size_t length) {
+        Fingerprint digest{};
+        unsigned int digestLength = 0;
+        if (EVP_Digest(data, length, digest.data(), &digestLength, EVP_sha1(), nullptr) != 1) {
+            throw std::runtime_error("Falha ao calcular SHA1 do chunk");
+        }
+        return digest;
+    }
+
+    struct FileChunks {
+        bool ok = false;
+        uint64_t size = 0;
+        std::vector<std::pair<Fingerprint, uint32_t>> chunks;
+    };
+
+    // ==================== PACK ====================
+    // "RTPACK01" | chunks únicos em sequência | manifesto | offset do
+    // manifesto (u64) | "RTPACK01". Manifesto: chunkCount (u64), por chunk
+    // tamanho (u32) + SHA1; fileCount (u32), por arquivo nome (u32 + bytes),
+    // tamanho (u64), quantos chunks (u32) e os ids (u32). Little-endian.
+    constexpr char PACK_MAGIC[8] = {'R', 'T', 'P', 'A', 'C', 'K', '0', '1'};
+
+    void putU32(std::string& out, uint32_t value) {
+        for (int i = 0; i < 4; ++i) out.push_back(static_cast<char>(value >> (8 * i)));
+    }
+
+    void putU64(std::string& out, uint64_t value) {
+        for (int i = 0; i < 8; ++i) out.push_back(static_cast<char>(value >> (8 * i)));
+    }
+
+    fs::path normalized(const fs::path& path) {
+        return fs::absolute(path).lexically_normal();
+    }
+
+    // Caminho de file dentro de root, ou vazio se estiver fora
+    fs::path relativeTo(const fs::path& file, const fs::path& root) {
+        fs::path relative = file.lexically_relative(root);
+        if (relative.empty() || *relative.begin() == "..") {
+            return {};
+        }
+        // A própria raiz é o arquivo (-p jogo.gba)
+        return relative == "." ? file.filename() : relative;
+    }
+
+    class PackReader {
+    public:
+        explicit PackReader(std::string_view data) : data(data) {}
+
+        uint32_t u32() { return static_cast<uint32_t>(number(4)); }
+        uint64_t u64() { return number(8); }
+
+        std::string_view bytes(size_t length) {
+            if (length > data.size() - position) {
+                throw std::runtime_error("Pack truncado");
+            }
+            std::string_view out = data.substr(position, length);
+            position += length;
+            return out;
+        }
+
+        void seek(size_t offset) {
+            if (offset > data.size()) {
+                throw std::runtime_error("Pack truncado");
+            }
+            position = offset;
+        }
+
+    private:
+        std::string_view data;
+        size_t position = 0;
+
+        uint64_t number(size_t width) {
+            std::string_view raw = bytes(width);
+            uint64_t value = 0;
+            for (size_t i = 0; i < width; ++i) {
+                value |= static_cast<uint64_t>(static_cast<uint8_t>(raw[i])) << (8 * i);
+            }
+            return value;
+        }
+    };
+}
+
+ChunkIndex::ChunkIndex(const ChunkOptions& options) {
+    // Potência de 2 entre MIN_AVERAGE_SIZE e MAX_AVERAGE_SIZE
+    uint32_t average = std::clamp(options.averageSize, MIN_AVERAGE_SIZE, MAX_AVERAGE_SIZE);
+    unsigned bits = log2Floor(average);
+    averageSize = 1u << bits;
+    minSize = averageSize / 4;
+    maxSize = averageSize * 8;
+    // Chunking normalizado nível 2 (FastCDC): ±2 bits em torno da média
+    smallMask = topBits(bits + 2);
+    largeMask = topBits(bits - 2);
+    threads = options.threads ? options.threads
+                              : std::max(1u, std::thread::hardware_concurrency());
+}
+
+size_t ChunkIndex::cutPoint(const uint8_t* data, size_t length) const {
+    if (length <= minSize) {
+        return length;
+    }
+
+    size_t end = std::min<size_t>(length, maxSize);
+    size_t normal = std::min<size_t>(end, averageSize);
+    uint64_t hash = 0;
+    size_t i = minSize;   // nenhum corte antes do mínimo: nem precisa de hash
+
+    for (; i < normal; ++i) {
+        hash = (hash << 1) + GEAR[data[i]];
+        if (!(hash & smallMask)) {
+            return i + 1;
+        }
+    }
+    for (; i < end; ++i) {
+        hash = (hash << 1) + GEAR[data[i]];
+        if (!(hash & largeMask)) {
+            return i + 1;
+        }
+    }
+    return end;
+}
+
+std::string ChunkIndex::setName(const fs::path& file) {
+    std::string name = file.stem().string();
+    size_t tag = name.find_first_of("([");
+    std::string base = name.substr(0, tag);
+    while (!base.empty() && (base.back() == ' ' || base.back() == '_')) {
+        base.pop_back();
+    }
+    return base.empty() ? name : base;
+}
+
+ChunkReport ChunkIndex::analyze(const std::vector<fs::path>& inputs) {
+    ChunkReport report;
+    report.library.name = "*";
+    files.clear();
+    chunkLengths.clear();
+    chunkPrints.clear();
+    chunkIds.clear();
+
+    // 1. Cortes + SHA1 de cada arquivo em paralelo
+    ThreadPool pool(threads);
+    std::vector<std::future<FileChunks>> pending;
+    pending.reserve(inputs.size());
+    for (const auto& path : inputs) {
+        pending.push_back(pool.enqueue([this, &path]() {
+            FileChunks result;
+            try {
+                MappedFile file(path);
+                const auto* data = reinterpret_cast<const uint8_t*>(file.view().data());
+                size_t length = file.size();
+                result.size = length;
+                result.chunks.reserve(length / averageSize + 1);
+                for (size_t offset = 0; offset < length;) {
+                    size_t cut = cutPoint(data + offset, length - offset);
+                    result.chunks.emplace_back(sha1Of(data + offset, cut),
+                                               static_cast<uint32_t>(cut));
+                    offset += cut;
+                }
+                result.ok = true;
+            } catch (const std::exception&) {
+                result.chunks.clear();
+            }
+            return result;
+        }));
+    }
+
+    // 2. Junção no índice, na ordem de entrada (enquanto os outros ainda cortam)
+    std::map<std::string, std::vector<size_t>> sets;
+    for (size_t i = 0; i < inputs.size(); ++i) {
+        FileChunks result = pending[i].get();
+        if (!result.ok) {
+            ++report.filesFailed;
+            continue;
+        }
+
+        IndexedFile indexed;
+        indexed.path = inputs[i];
+        indexed.size = result.size;
+        indexed.chunks.reserve(result.chunks.size());
+        for (const auto& [print, length] : result.chunks) {
+            auto [it, inserted] = chunkIds.try_emplace(print, static_cast<uint32_t>(chunkPrints.size()));
+            if (inserted) {
+                chunkPrints.push_back(print);
+                chunkLengths.push_back(length);
+            }
+            indexed.chunks.push_back(it->second);
+        }
+
+        sets[setName(inputs[i])].push_back(files.size());
+        files.push_back(std::move(indexed));
+    }
+
+    // 3. Estatísticas por conjunto e da biblioteca
+    auto summarize = [this](ChunkSetStats& stats, const std::vector<size_t>& members) {
+        std::unordered_set<uint32_t> seen;
+        for (size_t index : members) {
+            const IndexedFile& file = files[index];
+            ++stats.files;
+            stats.bytes += file.size;
+            stats.chunks += file.chunks.size();
+            for (uint32_t id : file.chunks) {
+                if (seen.insert(id).second) {
+                    stats.uniqueBytes += chunkLengths[id];
+                }
+            }
+        }
+        stats.uniqueChunks = seen.size();
+    };
+
+    for (const auto& [name, members] : sets) {
+        ChunkSetStats stats;
+        stats.name = name;
+        summarize(stats, members);
+        report.sets.push_back(std::move(stats));
+    }
+    std::stable_sort(report.sets.begin(), report.sets.end(),
+                     [](const ChunkSetStats& a, const ChunkSetStats& b) {
+                         return a.savedBytes() > b.savedBytes();
+                     });
+
+    // Biblioteca inteira: o índice já tem cada chunk uma vez
+    for (const IndexedFile& file : files) {
+        ++report.library.files;
+        report.library.bytes += file.size;
+        report.library.chunks += file.chunks.size();
+    }
+    report.library.uniqueChunks = chunkLengths.size();
+    for (uint32_t length : chunkLengths) {
+        report.library.uniqueBytes += length;
+    }
+
+    return report;
+}
+
+void ChunkIndex::writePack(const fs::path& packPath, const std::vector<fs::path>& roots) const {
+    // Nomes do manifesto: relativos à raiz mais específica que contém cada
+    // arquivo, então "-p ../roms" não vira "../roms/..." (o unpack recusa)
+    std::vector<fs::path> bases;
+    for (const auto& root : roots) {
+        bases.push_back(normalized(root));
+    }
+    if (bases.empty() && !files.empty()) {
+        fs::path common = normalized(files.front().path).parent_path();
+        for (const IndexedFile& file : files) {
+            fs::path parent = normalized(file.path).parent_path();
+            while (relativeTo(parent, common).empty()) {
+                common = common.parent_path();
+            }
+        }
+        bases.push_back(common);
+    }
+
+    std::vector<std::string> names;
+    std::unordered_set<std::string> seenNames;
+    names.reserve(files.size());
+    for (const IndexedFile& file : files) {
+        fs::path absolute = normalized(file.path);
+        fs::path name;
+        size_t bestLength = 0;
+        for (const auto& base : bases) {
+            fs::path relative = relativeTo(absolute, base);
+            size_t length = base.native().size();
+            if (!relative.empty() && (name.empty() || length > bestLength)) {
+                name = relative;
+                bestLength = length;
+            }
+        }
+        if (name.empty()) {
+            throw std::runtime_error("Arquivo fora das entradas do pack: " + file.path.string());
+        }
+        if (!seenNames.insert(name.generic_string()).second) {
+            throw std::runtime_error("Nome repetido no pack: " + name.generic_string());
+        }
+        names.push_back(name.generic_string());
+    }
+
+    if (packPath.has_parent_path()) {
+        fs::create_directories(packPath.parent_path());
+    }
+    // Grava ao lado e só troca no fim: falha no meio não deixa pack truncado
+    fs::path tempPath = packPath;
+    tempPath += ".tmp";
+    std::ofstream out(tempPath, std::ios::binary | std::ios::trunc);
+    if (!out.is_open()) {
+        throw std::runtime_error("Não foi possível criar: " + tempPath.string());
+    }
+    auto fail = [&](const std::string& message) {
+        out.close();
+        std::error_code ec;
+        fs::remove(tempPath, ec);
+        throw std::runtime_error(message);
+    };
+    out.write(PACK_MAGIC, sizeof(PACK_MAGIC));
+
+    // Chunks na ordem do primeiro uso; cada arquivo é relido uma vez e cada
+    // trecho confere com o SHA1 da análise (mesmo tamanho não basta)
+    std::vector<bool> written(chunkLengths.size(), false);
+    uint64_t position = sizeof(PACK_MAGIC);
+    MappedFile input;
+    for (const IndexedFile& file : files) {
+        try {
+            input.open(file.path);
+        } catch (const std::exception& e) {
+            fail(e.what());
+        }
+        if (input.size() != file.size) {
+            fail("Arquivo mudou desde a análise: " + file.path.string());
+        }
+        size_t offset = 0;
+        for (uint32_t id : file.chunks) {
+            const char* chunk = input.view().data() + offset;
+            if (sha1Of(chunk, chunkLengths[id]) != chunkPrints[id]) {
+                fail("Arquivo mudou desde a análise: " + file.path.string());
+            }
+            if (!written[id]) {
+                out.write(chunk, chunkLengths[id]);
+                written[id] = true;
+                position += chunkLengths[id];
+            }
+            offset += chunkLengths[id];
+        }
+    }
+    input.close();
+
+    std::string manifest;
+    putU64(manifest, chunkLengths.size());
+    for (size_t id = 0; id < chunkLengths.size(); ++id) {
+        putU32(manifest, chunkLengths[id]);
+        manifest.append(reinterpret_cast<const char*>(chunkPrints[id].data()), chunkPrints[id].size());
+    }
+    putU32(manifest, static_cast<uint32_t>(files.size()));
+    for (size_t i = 0; i < files.size(); ++i) {
+        const IndexedFile& file = files[i];
+        const std::string& name = names[i];
+        putU32(manifest, static_cast<uint32_t>(name.size()));
+        manifest += name;
+        putU64(manifest, file.size);
+        putU32(manifest, static_cast<uint32_t>(file.chunks.size()));
+        for (uint32_t id : file.chunks) {
+            putU32(manifest, id);
+        }
+    }
+    putU64(manifest, position);
+    manifest.append(PACK_MAGIC, sizeof(PACK_MAGIC));
+
+    out.write(manifest.data(), static_cast<std::streamsize>(manifest.size()));
+    out.close();
+    if (!out.good()) {
+        fail("Erro ao escrever: " + packPath.string());
+    }
+    fs::rename(tempPath, packPath);
+}
+
+size_t ChunkIndex::unpack(const fs::path& packPath, const fs::path& outputDir, bool overwrite) {
+    MappedFile pack(packPath);
+    std::string_view data = pack.view();
+    constexpr size_t footerSize = 8 + sizeof(PACK_MAGIC);
+    if (data.size() < sizeof(PACK_MAGIC) + footerSize ||
+        data.substr(0, sizeof(PACK_MAGIC)) != std::string_view(PACK_MAGIC, sizeof(PACK_MAGIC)) ||
+        data.substr(data.size() - sizeof(PACK_MAGIC)) != std::string_view(PACK_MAGIC, sizeof(PACK_MAGIC))) {
+        throw std::runtime_error("Não é um pack de chunks: " + packPath.string());
+    }
+
+    PackReader reader(data);
+    reader.seek(data.size() - footerSize);
+    reader.seek(reader.u64());
+
+    // Posição de cada chunk = soma dos anteriores
+    uint64_t chunkCount = reader.u64();
+    std::vector<std::string_view> chunks;
+    chunks.reserve(static_cast<size_t>(std::min<uint64_t>(chunkCount, data.size())));
+    size_t offset = sizeof(PACK_MAGIC);
+    for (uint64_t id = 0; id < chunkCount; ++id) {
+        uint32_t length = reader.u32();
+        std::string_view print = reader.bytes(20);
+        if (length > data.size() - offset) {
+            throw std::runtime_error("Pack truncado");
+        }
+        std::string_view chunk = data.substr(offset, length);
+        Fingerprint actual = sha1Of(chunk.data(), chunk.size());
+        if (std::string_view(reinterpret_cast<const char*>(actual.data()), actual.size()) != print) {
+            throw std::runtime_error("Chunk corrompido no pack: " + std::to_string(id));
+        }
+        chunks.push_back(chunk);
+        offset += length;
+    }
+
+    // Manifesto inteiro conferido antes de escrever qualquer arquivo
+    struct PackedFile {
+        fs::path target;
+        uint64_t size = 0;
+        std::vector<uint32_t> ids;
+    };
+    uint32_t fileCount = reader.u32();
+    std::vector<PackedFile> packed;
+    packed.reserve(std::min<uint32_t>(fileCount, 65536));
+    for (uint32_t i = 0; i < fileCount; ++i) {
+        fs::path name(std::string(reader.bytes(reader.u32())));
+        if (name.empty() || name.is_absolute() ||
+            std::find(name.begin(), name.end(), "..") != name.end()) {
+            throw std::runtime_error("Pack com caminho inválido: " + name.string());
+        }
+        PackedFile file;
+        file.target = outputDir / name;
+        file.size = reader.u64();
+        uint32_t refs = reader.u32();
+        uint64_t total = 0;
+        for (uint32_t r = 0; r < refs; ++r) {
+            uint32_t id = reader.u32();
+            if (id >= chunks.size()) {
+                throw std::runtime_error("Pack com referência inválida");
+            }
+            file.ids.push_back(id);
+            total += chunks[id].size();
+        }
+        if (total != file.size) {
+            throw std::runtime_error("Pack com tamanho inconsistente: " + name.string());
+        }
+        // Como no trim: saída existente só é trocada com --force
+        if (!overwrite && fs::exists(file.target)) {
+            throw std::runtime_error("Arquivo de saída já existe: " + file.target.string());
+        }
+        packed.push_back(std::move(file));
+    }
+
+    for (const PackedFile& file : packed) {
+        if (file.target.has_parent_path()) {
+            fs::create_directories(file.target.parent_path());
+        }
+        std::ofstream out(file.target, std::ios::binary | std::ios::trunc);
+        for (uint32_t id : file.ids) {
+            out.write(chunks[id].data(), static_cast<std::streamsize>(chunks[id].size()));
+        }
+        out.close();
+        if (!out.good()) {
+            throw std::runtime_error("Erro ao remontar: " + file.target.string());
+        }
+    }
+    return fileCount;
+}
@@ -0,0 +1,360 @@
+#include "DatCatalog.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+#include <stdexcept>
+#include <utility>
+
+namespace {
+
+const char* const STATUS_NAMES[] = {
+    "", "ok", "trimmed", "missing", "modified", "only_in_first", "only_in_second"
+};
+
+int hexValue(char c) {
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    return -1;
+}
+
+std::string toHex(const uint8_t* bytes, size_t length) {
+    static const char hex[] = "0123456789abcdef";
+    std::string out(length * 2, '0');
+    for (size_t i = 0; i < length; ++i) {
+        out[2 * i] = hex[bytes[i] >> 4];
+        out[2 * i + 1] = hex[bytes[i] & 0x0F];
+    }
+    return out;
+}
+
+// Comparação de nomes sem diferenciar caixa (ordem e igualdade)
+int compareIgnoringCase(std::string_view a, std::string_view b) {
+    size_t common = std::min(a.size(), b.size());
+    for (size_t i = 0; i < common; ++i) {
+        int ca = std::tolower(static_cast<unsigned char>(a[i]));
+        int cb = std::tolower(static_cast<unsigned char>(b[i]));
+        if (ca != cb) {
+            return ca < cb ? -1 : 1;
+        }
+    }
+    return a.size() == b.size() ? 0 : (a.size() < b.size() ? -1 : 1);
+}
+
+} // namespace
+
+// ==================== STATUS ====================
+
+const char* romStatusName(RomStatus status) {
+    return STATUS_NAMES[static_cast<size_t>(status)];
+}
+
+RomStatus parseRomStatus(std::string_view text) {
+    for (size_t i = 1; i < sizeof(STATUS_NAMES) / sizeof(STATUS_NAMES[0]); ++i) {
+        if (text == STATUS_NAMES[i]) {
+            return static_cast<RomStatus>(i);
+        }
+    }
+    return RomStatus::NONE;
+}
+
+// ==================== CONSTRUÇÃO ====================
+
+DatCatalog DatCatalog::load(const std::string& datPath) {
+    DatCatalog catalog;
+    DatIntegrator::parseDatFile(datPath, [&catalog](const RomEntry& entry) {
+        catalog.add(entry);
+    });
+    catalog.buildIndex();
+    return catalog;
+}
+
+DatCatalog DatCatalog::fromEntries(const std::vector<RomEntry>& entries) {
+    DatCatalog catalog;
+    catalog.reserve(entries.size());
+    for (const auto& entry : entries) {
+        catalog.add(entry);
+    }
+    catalog.buildIndex();
+    return catalog;
+}
+
+void DatCatalog::reserve(size_t count) {
+    nameOffsets.reserve(count + 1);
+    sizes.reserve(count);
+    crcs.reserve(count);
+    md5s.reserve(count);
+    sha1s.reserve(count);
+    flags.reserve(count);
+    statuses.reserve(count);
+}
+
+void DatCatalog::add(const RomEntry& entry) {
+    if (names.size() + entry.name.size() > UINT32_MAX) {
+        throw std::runtime_error("DAT grande demais para o catálogo");
+    }
+    names += entry.name;
+    nameOffsets.push_back(static_cast<uint32_t>(names.size()));
+
+    uint8_t present = 0;
+    uint64_t size = 0;
+    if (!entry.size.empty()) {
+        try {
+            size = std::stoull(entry.size);
+            present |= HAS_SIZE;
+        } catch (const std::exception&) {
+            // Tamanho ilegível: fica como ausente
+        }
+    }
+
+    uint8_t crcBytes[4];
+    uint32_t crc = 0;
+    if (parseHex(entry.crc32, crcBytes, sizeof(crcBytes))) {
+        crc = (uint32_t(crcBytes[0]) << 24) | (uint32_t(crcBytes[1]) << 16) |
+              (uint32_t(crcBytes[2]) << 8) | uint32_t(crcBytes[3]);
+        present |= HAS_CRC32;
+    }
+
+    Md5 md5{};
+    if (parseHex(entry.md5, md5.data(), md5.size())) {
+        present |= HAS_MD5;
+    }
+    Sha1 sha1{};
+    if (parseHex(entry.sha1, sha1.data(), sha1.size())) {
+        present |= HAS_SHA1;
+    }
+
+    sizes.push_back(size);
+    crcs.push_back(crc);
+    md5s.push_back(md5);
+    sha1s.push_back(sha1);
+    flags.push_back(present);
+    statuses.push_back(parseRomStatus(entry.status));
+}
+
+// ==================== COMPATIBILIDADE ====================
+
+RomEntry DatCatalog::entry(size_t i) const {
+    RomEntry entry;
+    entry.name = std::string(name(i));
+    if (hasSize(i)) {
+        entry.size = std::to_string(sizes[i]);
+    }
+    if (hasCrc32(i)) {
+        uint8_t bytes[4] = {uint8_t(crcs[i] >> 24), uint8_t(crcs[i] >> 16),
+                            uint8_t(crcs[i] >> 8), uint8_t(crcs[i])};
+        entry.crc32 = toHex(bytes, sizeof(bytes));
+    }
+    if (hasMd5(i)) {
+        entry.md5 = toHex(md5s[i].data(), md5s[i].size());
+    }
+    if (hasSha1(i)) {
+        entry.sha1 = toHex(sha1s[i].data(), sha1s[i].size());
+    }
+    entry.status = romStatusName(statuses[i]);
+    return entry;
+}
+
+std::vector<RomEntry> DatCatalog::toEntries() const {
+    std::vector<RomEntry> entries;
+    entries.reserve(size());
+    for (size_t i = 0; i < size(); ++i) {
+        entries.push_back(entry(i));
+    }
+    return entries;
+}
+
+// ==================== COMPARAÇÃO ====================
+
+bool DatCatalog::matches(size_t i, const ChecksumVerifier::Digests& digests) const {
+    if (hasSize(i) && sizes[i] != digests.size) {
+        return false;
+    }
+    if (hasCrc32(i) && crcs[i] != digests.crc32) {
+        return false;
+    }
+    if (hasMd5(i)) {
+        Md5 md5;
+        if (!parseHex(digests.md5, md5.data(), md5.size()) || md5 != md5s[i]) {
+            return false;
+        }
+    }
+    if (hasSha1(i)) {
+        Sha1 sha1;
+        if (!parseHex(digests.sha1, sha1.data(), sha1.size()) || sha1 != sha1s[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool DatCatalog::parseHex(std::string_view hex, uint8_t* out, size_t length) {
+    if (hex.size() != length * 2) {
+        return false;
+    }
+    for (size_t i = 0; i < length; ++i) {
+        int high = hexValue(hex[2 * i]);
+        int low = hexValue(hex[2 * i + 1]);
+        if (high < 0 || low < 0) {
+            return false;
+        }
+        out[i] = static_cast<uint8_t>((high << 4) | low);
+    }
+    return true;
+}
+
+// ==================== ÍNDICES ====================
+
+void DatCatalog::buildIndex() {
+    sha1Order.clear();
+    crcOrder.clear();
+    nameOrder.clear();
+    nameOrder.reserve(size());
+
+    for (size_t i = 0; i < size(); ++i) {
+        uint32_t index = static_cast<uint32_t>(i);
+        if (hasSha1(i)) sha1Order.push_back(index);
+        if (hasCrc32(i)) crcOrder.push_back(index);
+        nameOrder.push_back(index);
+    }
+
+    std::sort(sha1Order.begin(), sha1Order.end(),
+              [this](uint32_t a, uint32_t b) { return sha1s[a] < sha1s[b]; });
+    std::sort(crcOrder.begin(), crcOrder.end(),
+              [this](uint32_t a, uint32_t b) { return crcs[a] < crcs[b]; });
+    std::sort(nameOrder.begin(), nameOrder.end(), [this](uint32_t a, uint32_t b) {
+        return compareIgnoringCase(name(a), name(b)) < 0;
+    });
+}
+
+size_t DatCatalog::findBySha1(const Sha1& sha1) const {
+    auto it = std::lower_bound(sha1Order.begin(), sha1Order.end(), sha1,
+                               [this](uint32_t i, const Sha1& key) { return sha1s[i] < key; });
+    return it != sha1Order.end() && sha1s[*it] == sha1 ? *it : npos;
+}
+
+size_t DatCatalog::findByCrc32(uint32_t crc) const {
+    auto it = std::lower_bound(crcOrder.begin(), crcOrder.end(), crc,
+                               [this](uint32_t i, uint32_t key) { return crcs[i] < key; });
+    return it != crcOrder.end() && crcs[*it] == crc ? *it : npos;
+}
+
+size_t DatCatalog::findByName(std::string_view wanted) const {
+    auto it = std::lower_bound(nameOrder.begin(), nameOrder.end(), wanted,
+                               [this](uint32_t i, std::string_view key) {
+                                   return compareIgnoringCase(name(i), key) < 0;
+                               });
+    return it != nameOrder.end() && compareIgnoringCase(name(*it), wanted) == 0 ? *it : npos;
+}
+
+// ==================== DIFF ====================
+
+namespace {
+
+// Campos que diferem entre a[i] e b[j] (ausente de um lado só também conta)
+uint8_t fieldChanges(const DatCatalog& a, size_t i, const DatCatalog& b, size_t j) {
+    uint8_t changes = 0;
+    if (a.hasSize(i) != b.hasSize(j) || a.romSize(i) != b.romSize(j)) {
+        changes |= DAT_SIZE_CHANGED;
+    }
+    if (a.hasCrc32(i) != b.hasCrc32(j) || a.crc32(i) != b.crc32(j)) {
+        changes |= DAT_CRC32_CHANGED;
+    }
+    if (a.hasMd5(i) != b.hasMd5(j) || a.md5(i) != b.md5(j)) {
+        changes |= DAT_MD5_CHANGED;
+    }
+    if (a.hasSha1(i) != b.hasSha1(j) || a.sha1(i) != b.sha1(j)) {
+        changes |= DAT_SHA1_CHANGED;
+    }
+    return changes;
+}
+
+// Casa left e right (posições ainda sem par) pela chave de conteúdo:
+// ordena os dois lados pela chave e faz um merge. Pares vão para out e as
+// posições usadas viram NONE. has* dizem se a entrada tem a chave.
+template <class HasA, class HasB, class KeyA, class KeyB>
+void mergeByContent(std::vector<uint32_t>& left, std::vector<uint32_t>& right,
+                    HasA hasA, HasB hasB, KeyA keyA, KeyB keyB,
+                    std::vector<DatDifference>& out) {
+    std::vector<uint32_t*> l, r;
+    for (auto& x : left) if (x != DatDifference::NONE && hasA(x)) l.push_back(&x);
+    for (auto& y : right) if (y != DatDifference::NONE && hasB(y)) r.push_back(&y);
+    std::sort(l.begin(), l.end(), [&](uint32_t* x, uint32_t* y) { return keyA(*x) < keyA(*y); });
+    std::sort(r.begin(), r.end(), [&](uint32_t* x, uint32_t* y) { return keyB(*x) < keyB(*y); });
+
+    size_t li = 0, ri = 0;
+    while (li < l.size() && ri < r.size()) {
+        auto ka = keyA(*l[li]);
+        auto kb = keyB(*r[ri]);
+        if (ka < kb) {
+            ++li;
+        } else if (kb < ka) {
+            ++ri;
+        } else {
+            out.push_back({*l[li], *r[ri], DAT_RENAMED});
+            *l[li++] = DatDifference::NONE;
+            *r[ri++] = DatDifference::NONE;
+        }
+    }
+}
+
+} // namespace
+
+std::vector<DatDifference> DatCatalog::diff(const DatCatalog& a, const DatCatalog& b,
+                                            bool detectRenames) {
+    if (a.nameOrder.size() != a.size() || b.nameOrder.size() != b.size()) {
+        throw std::runtime_error("DatCatalog::diff sem buildIndex()");
+    }
+
+    std::vector<DatDifference> out;
+    std::vector<uint32_t> onlyFirst, onlySecond;
+
+    // 1. Merge pelos nomes (as duas ordens já estão prontas)
+    size_t i = 0, j = 0;
+    while (i < a.nameOrder.size() || j < b.nameOrder.size()) {
+        int order = i == a.nameOrder.size() ? 1
+                  : j == b.nameOrder.size() ? -1
+                  : compareIgnoringCase(a.name(a.nameOrder[i]), b.name(b.nameOrder[j]));
+        if (order < 0) {
+            onlyFirst.push_back(a.nameOrder[i++]);
+        } else if (order > 0) {
+            onlySecond.push_back(b.nameOrder[j++]);
+        } else {
+            uint32_t x = a.nameOrder[i++], y = b.nameOrder[j++];
+            if (uint8_t changes = fieldChanges(a, x, b, y)) {
+                out.push_back({x, y, changes});
+            }
+        }
+    }
+
+    // 2. Renomeados: SHA1 primeiro, depois CRC32 + tamanho
+    if (detectRenames && !onlyFirst.empty() && !onlySecond.empty()) {
+        size_t renamedFrom = out.size();
+        mergeByContent(onlyFirst, onlySecond,
+                       [&](uint32_t x) { return a.hasSha1(x); },
+                       [&](uint32_t y) { return b.hasSha1(y); },
+                       [&](uint32_t x) -> const Sha1& { return a.sha1(x); },
+                       [&](uint32_t y) -> const Sha1& { return b.sha1(y); },
+                       out);
+        mergeByContent(onlyFirst, onlySecond,
+                       [&](uint32_t x) { return a.hasCrc32(x) && a.hasSize(x); },
+                       [&](uint32_t y) { return b.hasCrc32(y) && b.hasSize(y); },
+                       [&](uint32_t x) { return std::make_pair(a.crc32(x), a.romSize(x)); },
+                       [&](uint32_t y) { return std::make_pair(b.crc32(y), b.romSize(y)); },
+                       out);
+
+        // Casados por SHA1 podem ter outro campo mudado também
+        for (size_t k = renamedFrom; k < out.size(); ++k) {
+            out[k].changes |= fieldChanges(a, out[k].first, b, out[k].second);
+        }
+    }
+
+    for (uint32_t x : onlyFirst) {
+        if (x != DatDifference::NONE) out.push_back({x, DatDifference::NONE, DAT_ONLY_IN_FIRST});
+    }
+    for (uint32_t y : onlySecond) {
+        if (y != DatDifference::NONE) out.push_back({DatDifference::NONE, y, DAT_ONLY_IN_SECOND});
+    }
+    return out;
+}
@@ -1,16 +1,20 @@
 // DatIntegration.cpp
 #include "DatIntegration.hpp"
+#include "DatCatalog.hpp"
 #include "ChecksumVerifier.hpp"
-#include <zlib.h>
+#include "N64ByteOrder.hpp"
+#include "RomDetector.hpp"
+#include "SnesHeader.hpp"
+#include "ThreadPool.hpp"
+#include "TrimEngine.hpp"
 #include <fstream>
 #include <sstream>
 #include <regex>
 #include <iomanip>
 #include <filesystem>
 #include <algorithm>
-#include <openssl/md5.h>
-#include <openssl/sha.h>
-#include <zlib.h>
+#include <cstdlib>
+#include <future>
 
 namespace fs = std::filesystem;
 
@@ -18,6 +22,19 @@ namespace fs = std::filesystem;
 
 std::vector<RomEntry> DatIntegrator::parseDatFile(const std::string& datPath) {
     std::vector<RomEntry> entries;
+    parseDatFile(datPath, [&entries](const RomEntry& entry) { entries.push_back(entry); });
+    return entries;
+}
+
+void DatIntegrator::parseDatFile(const std::string& datPath,
+                                 const std::function<void(const RomEntry&)>& onEntry) {
+    // Compiladas uma vez, não por linha
+    static const std::regex nameRegex("name=\"([^\"]+)\"");
+    static const std::regex sizeRegex("size=\"([^\"]+)\"");
+    static const std::regex crcRegex("crc=\"([^\"]+)\"");
+    static const std::regex md5Regex("md5=\"([^\"]+)\"");
+    static const std::regex sha1Regex("sha1=\"([^\"]+)\"");
+
     std::ifstream file(datPath);
     
     if (!file.is_open()) {
@@ -46,7 +63,6 @@ std::vector<RomEntry> DatIntegrator::parseDatFile(const std::string& datPath) {
             currentEntry = RomEntry();
             
             // Extract game name from attribute
-            std::regex nameRegex("name=\"([^\"]+)\"");
             std::smatch nameMatch;
             if (std::regex_search(line, nameMatch, nameRegex)) {
                 currentEntry.name = nameMatch[1].str();
@@ -57,7 +73,7 @@ std::vector<RomEntry> DatIntegrator::parseDatFile(const std::string& datPath) {
         // Check for game block end
         if (lineLower.find("</game>") != std::string::npos) {
             if (!currentEntry.name.empty()) {
-                entries.push_back(currentEntry);
+                onEntry(currentEntry);
             }
             inGame = false;
             continue;
@@ -68,12 +84,6 @@ std::vector<RomEntry> DatIntegrator::parseDatFile(const std::string& datPath) {
             inRom = true;
             
             // Extract ROM attributes
-            std::regex sizeRegex("size=\"([^\"]+)\"");
-            std::regex crcRegex("crc=\"([^\"]+)\"");
-            std::regex md5Regex("md5=\"([^\"]+)\"");
-            std::regex sha1Regex("sha1=\"([^\"]+)\"");
-            std::regex nameRegex("name=\"([^\"]+)\"");
-            
             std::smatch match;
             
             if (std::regex_search(line, match, sizeRegex)) {
@@ -120,82 +130,39 @@ std::vector<RomEntry> DatIntegrator::parseDatFile(const std::string& datPath) {
                 currentEntry.crc32 = tokens[3];
                 currentEntry.md5 = tokens[4];
                 currentEntry.sha1 = tokens[5];
-                entries.push_back(currentEntry);
+                onEntry(currentEntry);
             }
         }
     }
     
     file.close();
-    return entries;
 }
 
 // ==================== ROM VERIFICATION ====================
 
 bool DatIntegrator::verifyRom(const std::string& romPath, const RomEntry& entry) {
     try {
-        // Read ROM file
-        std::ifstream file(romPath, std::ios::binary | std::ios::ate);
-        if (!file.is_open()) {
+        auto checksums = calculateChecksums(romPath);
+        if (checksums.empty()) {
             return false;
         }
-        
-        size_t fileSize = static_cast<size_t>(file.tellg());
-        file.seekg(0, std::ios::beg);
-        
-        std::vector<uint8_t> buffer(fileSize);
-        file.read(reinterpret_cast<char*>(buffer.data()), fileSize);
-        file.close();
-        
-        std::string data(buffer.begin(), buffer.end());
-        
+
         // Verify size
-        if (!entry.size.empty()) {
-            size_t expectedSize = std::stoull(entry.size);
-            if (fileSize != expectedSize) {
-                return false;
-            }
+        if (!entry.size.empty() && checksums["size"] != std::to_string(std::stoull(entry.size))) {
+            return false;
         }
-        
-        // Verify CRC32
-        if (!entry.crc32.empty()) {
-            std::string calculatedCrc = calculateCRC32(data);
-            std::string expectedCrc = entry.crc32;
-            
-            // Convert to lowercase for case-insensitive comparison
-            std::transform(calculatedCrc.begin(), calculatedCrc.end(), calculatedCrc.begin(), ::tolower);
-            std::transform(expectedCrc.begin(), expectedCrc.end(), expectedCrc.begin(), ::tolower);
-            
-            if (calculatedCrc != expectedCrc) {
-                return false;
-            }
+
+        // Checksums calculados já saem em minúsculas
+        if (!entry.crc32.empty() && checksums["crc32"] != toLower(entry.crc32)) {
+            return false;
         }
-        
-        // Verify MD5
-        if (!entry.md5.empty()) {
-            std::string calculatedMd5 = calculateMD5(data);
-            std::string expectedMd5 = entry.md5;
-            
-            std::transform(calculatedMd5.begin(), calculatedMd5.end(), calculatedMd5.begin(), ::tolower);
-            std::transform(expectedMd5.begin(), expectedMd5.end(), expectedMd5.begin(), ::tolower);
-            
-            if (calculatedMd5 != expectedMd5) {
-                return false;
-            }
+        if (!entry.md5.empty() && checksums["md5"] != toLower(entry.md5)) {
+            return false;
         }
-        
-        // Verify SHA1
-        if (!entry.sha1.empty()) {
-            std::string calculatedSha1 = calculateSHA1(data);
-            std::string expectedSha1 = entry.sha1;
-            
-            std::transform(calculatedSha1.begin(), calculatedSha1.end(), calculatedSha1.begin(), ::tolower);
-            std::transform(expectedSha1.begin(), expectedSha1.end(), expectedSha1.begin(), ::tolower);
-            
-            if (calculatedSha1 != expectedSha1) {
-                return false;
-            }
+        if (!entry.sha1.empty() && checksums["sha1"] != toLower(entry.sha1)) {
+            return false;
         }
-        
+
         return true;
         
     } catch (const std::exception& e) {
@@ -203,85 +170,189 @@ bool DatIntegrator::verifyRom(const std::string& romPath, const RomEntry& entry)
     }
 }
 
+bool DatIntegrator::verifyRom(const std::string& romPath, const DatCatalog& catalog,
+                              size_t index) {
+    ChecksumVerifier::Digests digests;
+    return calculateDigests(romPath, digests) && catalog.matches(index, digests);
+}
+
 // ==================== CHECKSUM CALCULATION ====================
 
 std::unordered_map<std::string, std::string> DatIntegrator::calculateChecksums(
     const std::string& filePath) {
     
     std::unordered_map<std::string, std::string> checksums;
-    
+    ChecksumVerifier::Digests digests;
+    if (!calculateDigests(filePath, digests)) {
+        return checksums;
+    }
+
+    checksums["size"] = std::to_string(digests.size);
+    checksums["crc32"] = digests.crc32Hex;
+    checksums["md5"] = digests.md5;
+    checksums["sha1"] = digests.sha1;
+    return checksums;
+}
+
+namespace {
+
+// Passa o arquivo pelo stream na ordem dos DATs: N64 .v64/.n64 normalizado
+// no próprio bloco para .z64 e SNES sem o header de copiadora (só se pula
+// o começo do primeiro bloco)
+bool hashInDatOrder(const std::string& filePath, ChecksumVerifier::Stream& stream) {
+    std::ifstream file(filePath, std::ios::binary);
+    if (!file.is_open()) {
+        return false;
+    }
+
+    std::vector<char> chunk(N64_STREAM_CHUNK);
+    N64ByteOrder order = N64ByteOrder::UNKNOWN;
+    bool firstBlock = true;
+    std::error_code ec;
+    size_t diskSize = static_cast<size_t>(fs::file_size(filePath, ec));
+
+    while (file.read(chunk.data(), static_cast<std::streamsize>(chunk.size())) ||
+           file.gcount() > 0) {
+        std::string_view block(chunk.data(), static_cast<size_t>(file.gcount()));
+        if (firstBlock) {
+            order = detectN64ByteOrder(block);
+            if (RomDetector().detectHeader(block, diskSize) == RomType::SNES) {
+                block.remove_prefix(parseSnesLayout(block, diskSize).copierHeader);
+            }
+            firstBlock = false;
+        }
+        if (needsN64Normalization(order)) {
+            normalizeN64(chunk.data(), chunk.data(), block.size(), order);
+        }
+        stream.update(block.data(), block.size());
+    }
+    return !file.bad();
+}
+
+// Entrega [begin, end) de rom a fn em ordem .z64 se preciso. begin múltiplo
+// de 4; a palavra incompleta do fim de rom passa como está (igual ao
+// calculateChecksums do arquivo)
+template <class Fn>
+void forEachDatBlock(std::string_view rom, size_t begin, size_t end, N64ByteOrder order,
+                     std::vector<char>& scratch, Fn&& fn) {
+    if (!needsN64Normalization(order)) {
+        fn(rom.data() + begin, end - begin);
+        return;
+    }
+    for (size_t pos = begin; pos < end; pos += scratch.size()) {
+        size_t length = std::min(scratch.size(), end - pos);
+        normalizeN64(rom.data() + pos, scratch.data(), length, order);
+        fn(scratch.data(), length);
+    }
+}
+
+// Parte de um arquivo mapeado que os DATs descrevem (SNES sem o header)
+std::string_view datPayload(std::string_view data) {
+    std::string_view head = data.substr(0, RomDetector::HEADER_WINDOW);
+    if (RomDetector().detectHeader(head, data.size()) == RomType::SNES) {
+        return data.substr(parseSnesLayout(head, data.size()).copierHeader);
+    }
+    return data;
+}
+
+bool digestsMatch(const ChecksumVerifier::Digests& digests, const RomEntry& entry) {
+    auto lower = [](std::string s) {
+        std::transform(s.begin(), s.end(), s.begin(), ::tolower);
+        return s;
+    };
+    return (entry.crc32.empty() || digests.crc32Hex == lower(entry.crc32)) &&
+           (entry.md5.empty() || digests.md5 == lower(entry.md5)) &&
+           (entry.sha1.empty() || digests.sha1 == lower(entry.sha1));
+}
+
+// stream já tem os bytes que ficaram no disco; testa se algum byte de
+// padding repetido até originalSize reproduz a entrada do DAT
+bool matchesWithPadding(const ChecksumVerifier::Stream& stream, const RomEntry& entry,
+                        uint64_t originalSize, uint8_t* paddingByte) {
+    if (stream.bytesHashed() > originalSize) {
+        return false;
+    }
+    uint64_t removed = originalSize - stream.bytesHashed();
+
+    // Com CRC no DAT qualquer byte de padding é testado em O(log n);
+    // sem ele só os dois usuais, cada um pagando MD5/SHA1 da cauda
+    std::vector<uint8_t> candidates = {0xFF, 0x00};
+    if (!entry.crc32.empty()) {
+        for (int value = 0x01; value < 0xFF; ++value) {
+            candidates.push_back(static_cast<uint8_t>(value));
+        }
+    }
+
+    for (uint8_t value : candidates) {
+        if (!entry.crc32.empty()) {
+            uint32_t crc = ChecksumVerifier::crc32Combine(
+                stream.currentCrc32(), ChecksumVerifier::crc32Run(value, removed), removed);
+            if (crc != static_cast<uint32_t>(std::stoul(entry.crc32, nullptr, 16))) {
+                continue;
+            }
+        }
+
+        ChecksumVerifier::Stream restored(stream);
+        restored.updateRun(value, removed);
+        if (digestsMatch(restored.finish(), entry)) {
+            if (paddingByte) {
+                *paddingByte = value;
+            }
+            return true;
+        }
+    }
+    return false;
+}
+
+} // namespace
+
+bool DatIntegrator::calculateDigests(const std::string& filePath,
+                                     ChecksumVerifier::Digests& digests,
+                                     bool withSha256) {
     try {
-        // Read file
-        std::ifstream file(filePath, std::ios::binary | std::ios::ate);
-        if (!file.is_open()) {
-            return checksums;
+        ChecksumVerifier::Stream stream(withSha256);
+        if (!hashInDatOrder(filePath, stream)) {
+            return false;
         }
-        
-        size_t fileSize = static_cast<size_t>(file.tellg());
-        file.seekg(0, std::ios::beg);
-        
-        std::vector<uint8_t> buffer(fileSize);
-        file.read(reinterpret_cast<char*>(buffer.data()), fileSize);
-        file.close();
-        
-        std::string data(buffer.begin(), buffer.end());
-        
-        // Calculate checksums
-        checksums["size"] = std::to_string(fileSize);
-        checksums["crc32"] = calculateCRC32(data);
-        checksums["md5"] = calculateMD5(data);
-        checksums["sha1"] = calculateSHA1(data);
-        
+        digests = stream.finish();
+        return true;
     } catch (const std::exception& e) {
-        // Return empty map on error
+        return false;
+    }
+}
+
+bool DatIntegrator::verifyTrimmedRom(const std::string& romPath, const RomEntry& entry,
+                                     uint8_t* paddingByte) {
+    try {
+        if (entry.size.empty()) {
+            return false;
+        }
+        uint64_t originalSize = std::stoull(entry.size);
+
+        // Só os bytes que ficaram são lidos
+        ChecksumVerifier::Stream stream;
+        if (!hashInDatOrder(romPath, stream)) {
+            return false;
+        }
+        return matchesWithPadding(stream, entry, originalSize, paddingByte);
+
+    } catch (const std::exception& e) {
+        return false;
     }
-    
-    return checksums;
 }
 
 // ==================== CHECKSUM ALGORITHMS ====================
 
 std::string DatIntegrator::calculateCRC32(const std::string& data) {
-    uLong crc = crc32(0L, Z_NULL, 0);
-    crc = crc32(crc, reinterpret_cast<const Bytef*>(data.data()), data.size());
-    
-    std::stringstream ss;
-    ss << std::hex << std::setfill('0') << std::setw(8) << crc;
-    return ss.str();
+    return ChecksumVerifier().calculate(data, ChecksumVerifier::ChecksumType::CRC32);
 }
 
 std::string DatIntegrator::calculateMD5(const std::string& data) {
-    MD5_CTX context;
-    MD5_Init(&context);
-    MD5_Update(&context, data.data(), data.size());
-    
-    unsigned char digest[MD5_DIGEST_LENGTH];
-    MD5_Final(digest, &context);
-    
-    std::stringstream ss;
-    for (int i = 0; i < MD5_DIGEST_LENGTH; i++) {
-        ss << std::hex << std::setfill('0') << std::setw(2) 
-           << static_cast<unsigned int>(digest[i]);
-    }
-    
-    return ss.str();
+    return ChecksumVerifier().calculate(data, ChecksumVerifier::ChecksumType::MD5);
 }
 
 std::string DatIntegrator::calculateSHA1(const std::string& data) {
-    SHA_CTX context;
-    SHA1_Init(&context);
-    SHA1_Update(&context, data.data(), data.size());
-    
-    unsigned char digest[SHA_DIGEST_LENGTH];
-    SHA1_Final(digest, &context);
-    
-    std::stringstream ss;
-    for (int i = 0; i < SHA_DIGEST_LENGTH; i++) {
-        ss << std::hex << std::setfill('0') << std::setw(2) 
-           << static_cast<unsigned int>(digest[i]);
-    }
-    
-    return ss.str();
+    return ChecksumVerifier().calculate(data, ChecksumVerifier::ChecksumType::SHA1);
 }
 
 // ==================== DAT GENERATION ====================
@@ -398,10 +469,28 @@ std::unordered_map<std::string, RomEntry> DatIntegrator::verifyDirectoryAgainstD
                 auto it = entryMap.find(filenameLower);
                 if (it != entryMap.end()) {
                     const RomEntry* expectedEntry = it->second;
-                    bool verified = verifyRom(filePath.string(), *expectedEntry);
-                    
                     RomEntry result = *expectedEntry;
-                    result.status = verified ? "ok" : "modified";
+                    result.status = "modified";
+
+                    // Uma leitura só: do tamanho lido sai qual comparação vale
+                    // (inteira ou com o padding recolocado)
+                    try {
+                        ChecksumVerifier::Stream stream;
+                        if (hashInDatOrder(filePath.string(), stream)) {
+                            if (expectedEntry->size.empty() ||
+                                stream.bytesHashed() == std::stoull(expectedEntry->size)) {
+                                if (digestsMatch(stream.finish(), *expectedEntry)) {
+                                    result.status = "ok";
+                                }
+                            } else if (matchesWithPadding(stream, *expectedEntry,
+                                                          std::stoull(expectedEntry->size),
+                                                          nullptr)) {
+                                result.status = "trimmed";
+                            }
+                        }
+                    } catch (const std::exception&) {
+                        // Ilegível ou DAT com número inválido: fica "modified"
+                    }
                     results[filename] = result;
                 } else {
                     // Not in DAT
@@ -485,69 +574,28 @@ std::vector<RomEntry> DatIntegrator::diffDatFiles(
     const std::vector<RomEntry>& dat1,
     const std::vector<RomEntry>& dat2) {
     
+    // Merge ordenado sobre catálogos; aqui só se converte o resultado
+    // para o formato antigo (sem detectar renomeados)
+    DatCatalog first = DatCatalog::fromEntries(dat1);
+    DatCatalog second = DatCatalog::fromEntries(dat2);
+
     std::vector<RomEntry> differences;
-    
-    // Create lookup maps
-    std::unordered_map<std::string, const RomEntry*> map1;
-    for (const auto& entry : dat1) {
-        map1[toLower(entry.name)] = &entry;
-    }
-    
-    std::unordered_map<std::string, const RomEntry*> map2;
-    for (const auto& entry : dat2) {
-        map2[toLower(entry.name)] = &entry;
-    }
-    
-    // Find entries only in dat1
-    for (const auto& [name, entry] : map1) {
-        if (map2.find(name) == map2.end()) {
-            RomEntry diffEntry = *entry;
-            diffEntry.status = "only_in_first";
-            differences.push_back(diffEntry);
-        }
-    }
-    
-    // Find entries only in dat2
-    for (const auto& [name, entry] : map2) {
-        if (map1.find(name) == map1.end()) {
-            RomEntry diffEntry = *entry;
-            diffEntry.status = "only_in_second";
-            differences.push_back(diffEntry);
-        }
-    }
-    
-    // Find differing entries
-    for (const auto& [name, entry1] : map1) {
-        auto it = map2.find(name);
-        if (it != map2.end()) {
-            const RomEntry* entry2 = it->second;
-            
-            // Compare checksums
-            bool different = false;
+    for (const DatDifference& difference : DatCatalog::diff(first, second, false)) {
+        if (difference.changes & DAT_ONLY_IN_FIRST) {
+            differences.push_back(dat1[difference.first]);
+            differences.back().status = "only_in_first";
+        } else if (difference.changes & DAT_ONLY_IN_SECOND) {
+            differences.push_back(dat2[difference.second]);
+            differences.back().status = "only_in_second";
+        } else {
             std::string differencesStr;
-            
-            if (entry1->size != entry2->size) {
-                different = true;
-                differencesStr += "size ";
-            }
-            if (entry1->crc32 != entry2->crc32) {
-                different = true;
-                differencesStr += "crc32 ";
-            }
-            if (entry1->md5 != entry2->md5) {
-                different = true;
-                differencesStr += "md5 ";
-            }
-            if (entry1->sha1 != entry2->sha1) {
-                different = true;
-                differencesStr += "sha1 ";
-            }
-            
-            if (different) {
-                RomEntry diffEntry = *entry1;
-                diffEntry.status = "different: " + differencesStr;
-                differences.push_back(diffEntry);
-            }
+            if (difference.changes & DAT_SIZE_CHANGED) differencesStr += "size ";
+            if (difference.changes & DAT_CRC32_CHANGED) differencesStr += "crc32 ";
+            if (difference.changes & DAT_MD5_CHANGED) differencesStr += "md5 ";
+            if (difference.changes & DAT_SHA1_CHANGED) differencesStr += "sha1 ";
+
+            differences.push_back(dat1[difference.first]);
+            differences.back().status = "different: " + differencesStr;
         }
     }
     
@@ -562,72 +610,127 @@ bool DatIntegrator::renameFilesToDatNames(
     bool dryRun) {
     
     try {
-        // Create lookup map by checksum
-        std::unordered_map<std::string, std::string> crcToName;
-        std::unordered_map<std::string, std::string> md5ToName;
-        std::unordered_map<std::string, std::string> sha1ToName;
-        
+        // Índice numérico por CRC32 (vários jogos podem dividir um CRC);
+        // entradas sem CRC só são achadas pelos digests
+        std::unordered_multimap<uint32_t, const RomEntry*> byCrc32;
+        std::unordered_map<std::string, const RomEntry*> bySha1;
+        bool needsDigestLookup = false;
+
         for (const auto& entry : datEntries) {
-            if (!entry.crc32.empty()) {
-                crcToName[toLower(entry.crc32)] = entry.name;
-            }
-            if (!entry.md5.empty()) {
-                md5ToName[toLower(entry.md5)] = entry.name;
-            }
-            if (!entry.sha1.empty()) {
-                sha1ToName[toLower(entry.sha1)] = entry.name;
+            char* end = nullptr;
+            unsigned long crc = std::strtoul(entry.crc32.c_str(), &end, 16);
+            if (!entry.crc32.empty() && *end == '\0') {
+                byCrc32.emplace(static_cast<uint32_t>(crc), &entry);
+            } else if (!entry.sha1.empty()) {
+                bySha1.emplace(toLower(entry.sha1), &entry);
+                needsDigestLookup = true;
             }
         }
-        
-        // Process files
-        int renamed = 0;
-        for (const auto& entry : fs::directory_iterator(directoryPath)) {
-            if (fs::is_regular_file(entry.path())) {
-                std::string filePath = entry.path().string();
-                auto checksums = calculateChecksums(filePath);
-                
-                std::string newName;
-                
-                // Try to match by SHA1
-                if (!checksums["sha1"].empty()) {
-                    auto it = sha1ToName.find(toLower(checksums["sha1"]));
-                    if (it != sha1ToName.end()) {
-                        newName = it->second;
-                    }
+
+        // Identificação: CRC32 em um passe sobre o mapeamento; SHA1/MD5 só
+        // quando há candidato (as páginas já estão no cache). O rename é
+        // feito na própria tarefa: RENAME_NOREPLACE dispensa trava entre
+        // threads e nunca sobrescreve um arquivo
+        auto processFile = [&](const fs::path& filePath) -> bool {
+            MappedFile input(filePath);
+            std::string_view rom = datPayload(input.view());
+            N64ByteOrder order = detectN64ByteOrder(rom);
+            std::vector<char> scratch(needsN64Normalization(order) ? N64_STREAM_CHUNK : 0);
+
+            uint32_t crc = 0;
+            forEachDatBlock(rom, 0, rom.size(), order, scratch,
+                            [&crc](const char* block, size_t length) {
+                                crc = ChecksumVerifier::crc32Update(crc, block, length);
+                            });
+
+            auto candidates = byCrc32.equal_range(crc);
+            if (candidates.first == candidates.second && !needsDigestLookup) {
+                return false;
+            }
+
+            ChecksumVerifier::Stream stream;
+            forEachDatBlock(rom, 0, rom.size(), order, scratch,
+                            [&stream](const char* block, size_t length) {
+                                stream.update(block, length);
+                            });
+            ChecksumVerifier::Digests digests = stream.finish();
+
+            const RomEntry* match = nullptr;
+            for (auto it = candidates.first; it != candidates.second && !match; ++it) {
+                if (digestsMatch(digests, *it->second)) {
+                    match = it->second;
                 }
-                
-                // Try to match by MD5
-                if (newName.empty() && !checksums["md5"].empty()) {
-                    auto it = md5ToName.find(toLower(checksums["md5"]));
-                    if (it != md5ToName.end()) {
-                        newName = it->second;
-                    }
+            }
+            if (!match) {
+                auto it = bySha1.find(digests.sha1);
+                if (it == bySha1.end()) {
+                    return false;
                 }
-                
-                // Try to match by CRC32
-                if (newName.empty() && !checksums["crc32"].empty()) {
-                    auto it = crcToName.find(toLower(checksums["crc32"]));
-                    if (it != crcToName.end()) {
-                        newName = it->second;
-                    }
+                match = it->second;
+            }
+
+            // Nome do DAT; sem extensão, mantém a do arquivo
+            fs::path newName = fs::path(match->name).filename();
+            if (!newName.has_extension()) {
+                newName += filePath.extension();
+            }
+            // Já nomeado, inclusive como a cópia "Nome (n).ext" que este
+            // rename gera (só esse formato: "Nome (World).ext" é outro nome)
+            std::string current = filePath.filename().string();
+            std::string copyPrefix = newName.stem().string() + " (";
+            std::string copySuffix = ")" + newName.extension().string();
+            if (newName == filePath.filename()) {
+                return false;
+            }
+            if (current.size() > copyPrefix.size() + copySuffix.size() &&
+                current.compare(0, copyPrefix.size(), copyPrefix) == 0 &&
+                current.compare(current.size() - copySuffix.size(), copySuffix.size(), copySuffix) == 0) {
+                std::string number = current.substr(copyPrefix.size(),
+                                                    current.size() - copyPrefix.size() - copySuffix.size());
+                if (number.size() <= 2 &&
+                    std::all_of(number.begin(), number.end(), [](char c) { return c >= '0' && c <= '9'; })) {
+                    return false;
                 }
-                
-                // Rename if matched
-                if (!newName.empty()) {
-                    fs::path newPath = fs::path(directoryPath) / newName;
-                    
-                    if (!dryRun) {
-                        try {
-                            fs::rename(entry.path(), newPath);
-                            renamed++;
-                        } catch (const fs::filesystem_error& e) {
-                            // Log error
-                        }
-                    } else {
-                        // Just log what would happen
-                        renamed++;
-                    }
+            }
+            if (dryRun) {
+                return true;
+            }
+
+            input.close();
+            fs::path target = filePath.parent_path() / newName;
+            for (int copy = 2; !renameNoReplace(filePath, target); ++copy) {
+                // Dump repetido ou nome já ocupado: "Nome (2).ext", ...
+                if (copy > 99) {
+                    return false;
                 }
+                target = filePath.parent_path() /
+                         (newName.stem().string() + " (" + std::to_string(copy) + ")" +
+                          newName.extension().string());
+            }
+            return true;
+        };
+
+        // Listagem fechada antes de renomear: o iterador não pode ver os
+        // nomes novos que as tarefas criam no mesmo diretório
+        std::vector<fs::path> files;
+        for (const auto& entry : fs::directory_iterator(directoryPath)) {
+            if (entry.is_regular_file()) {
+                files.push_back(entry.path());
+            }
+        }
+
+        ThreadPool pool;
+        std::vector<std::future<bool>> pending;
+        for (const auto& file : files) {
+            pending.push_back(pool.enqueue(processFile, file));
+        }
+
+        size_t renamed = 0;
+        for (auto& future : pending) {
+            try {
+                renamed += future.get() ? 1 : 0;
+            } catch (const std::exception& e) {
+                // Arquivo ilegível ou rename recusado: segue com os outros
             }
         }
         
@@ -796,7 +899,7 @@ struct RomSetStats DatIntegrator::calculateRomSetStats(
             }
         }
         
-        if (entry.status == "ok") {
+        if (entry.status == "ok" || entry.status == "trimmed") {
             stats.verified++;
         } else if (entry.status == "missing") {
             stats.missing++;
@@ -872,36 +975,135 @@ size_t DatIntegrator::countSubstring(const std::string& str,
 
 // ==================== INTEGRATION WITH ROMTRIMMER ====================
 
+namespace {
+
+std::unordered_map<std::string, std::string> digestMap(const ChecksumVerifier::Digests& digests) {
+    return {{"size", std::to_string(digests.size)},
+            {"crc32", digests.crc32Hex},
+            {"md5", digests.md5},
+            {"sha1", digests.sha1}};
+}
+
+struct FusedResult {
+    const RomEntry* entry = nullptr;
+    std::unordered_map<std::string, std::string> checksums;
+};
+
+} // namespace
+
 std::unordered_map<std::string, std::unordered_map<std::string, std::string>>
 DatIntegrator::processDirectoryWithDat(
     const std::string& directoryPath,
     const std::string& datPath,
     bool trimFiles,
-    const std::string& outputDir) {
+    const std::string& outputDir,
+    const std::string& outputDatPath,
+    const TrimOptions& options) {
     
     std::unordered_map<std::string, std::unordered_map<std::string, std::string>> results;
     
     try {
-        // Parse DAT file
         auto datEntries = parseDatFile(datPath);
-        
-        // Verify each file against DAT
-        auto verificationResults = verifyDirectoryAgainstDat(directoryPath, datEntries, false);
-        
-        // Process each file
-        for (const auto& [filename, datEntry] : verificationResults) {
-            if (datEntry.status == "ok" && trimFiles) {
-                // File is verified, can be trimmed
-                std::string inputPath = (fs::path(directoryPath) / filename).string();
-                std::string outputPath = outputDir.empty() 
-                    ? inputPath 
-                    : (fs::path(outputDir) / filename).string();
-                
-                // Here you would call your trimming function
-                // For now, just calculate new checksums
-                auto checksums = calculateChecksums(inputPath);
-                results[datEntry.name] = checksums;
+
+        // Índices do DAT: nome do arquivo primeiro, hashes para renomeados
+        std::unordered_map<std::string, const RomEntry*> byName, bySha1, byCrc32;
+        for (const auto& entry : datEntries) {
+            byName.emplace(toLower(fs::path(entry.name).filename().string()), &entry);
+            if (!entry.sha1.empty()) bySha1.emplace(toLower(entry.sha1), &entry);
+            if (!entry.crc32.empty()) byCrc32.emplace(toLower(entry.crc32), &entry);
+        }
+
+        TrimEngine engine(options);
+
+        auto processFile = [&](const fs::path& filePath) -> FusedResult {
+            FusedResult result;
+            MappedFile input(filePath);
+            std::string_view view = input.view();
+
+            // 1. Decisão de corte sobre o mapeamento (só a cauda é varrida)
+            TrimReport report = engine.analyzeData(view);
+            bool canTrim = report.ok() && report.hasPadding;
+
+            // 2. Original e prefixo mantido no mesmo passe, em ordem de DAT:
+            //    o stream é copiado no ponto de corte e segue até o fim
+            std::string_view rom = view.substr(report.headerSize);
+            N64ByteOrder order = detectN64ByteOrder(rom);
+            size_t keep = (canTrim ? report.trimPoint : view.size()) - report.headerSize;
+            size_t cut = needsN64Normalization(order) ? keep & ~size_t(3) : keep;
+            std::vector<char> scratch(needsN64Normalization(order) ? N64_STREAM_CHUNK : 0);
+
+            ChecksumVerifier::Stream stream;
+            auto feed = [&stream](const char* block, size_t length) {
+                stream.update(block, length);
+            };
+            forEachDatBlock(rom, 0, cut, order, scratch, feed);
+            ChecksumVerifier::Stream trimmed(stream);
+            trimmed.update(rom.data() + cut, keep - cut);
+            forEachDatBlock(rom, cut, rom.size(), order, scratch, feed);
+            ChecksumVerifier::Digests original = stream.finish();
+
+            // 3. Verificação contra o DAT: o nome pode apontar para a entrada
+            //    errada (arquivo renomeado), então os hashes ainda valem
+            auto verified = [&original](const RomEntry* candidate) {
+                return digestsMatch(original, *candidate) &&
+                       (candidate->size.empty() || std::to_string(original.size) == candidate->size);
+            };
+            const RomEntry* entry = nullptr;
+            auto name = byName.find(toLower(filePath.filename().string()));
+            auto sha1 = bySha1.find(original.sha1);
+            auto crc = byCrc32.find(original.crc32Hex);
+            if (name != byName.end() && verified(name->second)) {
+                entry = name->second;
+            } else if (sha1 != bySha1.end() && verified(sha1->second)) {
+                entry = sha1->second;
+            } else if (crc != byCrc32.end() && verified(crc->second)) {
+                entry = crc->second;
+            } else {
+                return result;
             }
+            result.entry = entry;
+
+            // 4. Corte a partir do mesmo mapeamento. Os checksums descrevem o
+            //    que ficou no disco: os do corte só se ele foi gravado
+            fs::path outputPath = outputDir.empty() ? filePath
+                                                    : fs::path(outputDir) / filePath.filename();
+            const char* status = "unchanged";
+            if (canTrim && !trimFiles) {
+                status = "would_trim";
+            } else if (canTrim) {
+                report = engine.commit(input, report, outputPath);
+                status = report.trimmed ? "trimmed" : "error";
+            }
+
+            result.checksums = digestMap(report.trimmed ? trimmed.finish() : original);
+            result.checksums["status"] = status;
+            if (report.trimmed) {
+                result.checksums["output"] = report.outputPath.string();
+            }
+            return result;
+        };
+
+        ThreadPool pool;
+        std::vector<std::future<FusedResult>> pending;
+        for (const auto& item : fs::directory_iterator(directoryPath)) {
+            if (item.is_regular_file()) {
+                pending.push_back(pool.enqueue(processFile, item.path()));
+            }
+        }
+
+        for (auto& future : pending) {
+            try {
+                FusedResult result = future.get();
+                if (result.entry) {
+                    results[result.entry->name] = std::move(result.checksums);
+                }
+            } catch (const std::exception& e) {
+                // Arquivo ilegível: fica fora do resultado, como os não verificados
+            }
+        }
+
+        if (!outputDatPath.empty()) {
+            generateTrimmedDat(datEntries, outputDatPath, results);
         }
         
     } catch (const std::exception& e) {
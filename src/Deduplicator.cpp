@@ -0,0 +1,389 @@
+#include "Deduplicator.hpp"
+#include "ChecksumVerifier.hpp"
+#include "MappedFile.hpp"
+#include "ThreadPool.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <future>
+#include <stdexcept>
+#include <tuple>
+
+#ifndef _WIN32
+    #include <fcntl.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+#ifdef __linux__
+    #include <linux/fiemap.h>
+    #include <linux/fs.h>
+    #include <sys/ioctl.h>
+#endif
+
+namespace {
+    // Janela do filtro barato em cada ponta: pega headers e padding
+    // diferentes sem ler o meio do arquivo
+    constexpr size_t EDGE_BYTES = 64 * 1024;
+
+    // Teto por chamada do FIDEDUPERANGE (o btrfs, por exemplo, limita a 16 MiB)
+    constexpr uint64_t DEDUPE_STEP = 16 * 1024 * 1024;
+
+    struct Candidate {
+        size_t order;        // posição na lista de entrada
+        uint64_t size = 0;
+        Deduplicator::FileStamp stamp;
+        uint64_t device = 0;
+        uint64_t inode = 0;
+        uint32_t edgeCrc = 0;
+        ChecksumVerifier::Digests digests;
+    };
+
+    bool statFile(const fs::path& path, Candidate& file) {
+#ifndef _WIN32
+        struct stat info {};
+        if (::stat(path.c_str(), &info) != 0 || !S_ISREG(info.st_mode)) {
+            return false;
+        }
+        file.size = static_cast<uint64_t>(info.st_size);
+        file.stamp = Deduplicator::stamp(path);
+        file.device = static_cast<uint64_t>(info.st_dev);
+        file.inode = static_cast<uint64_t>(info.st_ino);
+        return true;
+#else
+        std::error_code ec;
+        file.size = fs::file_size(path, ec);
+        file.inode = file.order + 1;   // sem inode: todo arquivo é único
+        return !ec;
+#endif
+    }
+
+    uint32_t edgeCrc(const fs::path& path) {
+        MappedFile file(path);
+        std::string_view data = file.view();
+        size_t head = std::min(data.size(), EDGE_BYTES);
+        uint32_t crc = ChecksumVerifier::crc32Update(0, data.data(), head);
+        size_t tail = std::min(data.size() - head, EDGE_BYTES);
+        return ChecksumVerifier::crc32Update(crc, data.data() + data.size() - tail, tail);
+    }
+
+    ChecksumVerifier::Digests fullDigests(const fs::path& path) {
+        MappedFile file(path);
+        ChecksumVerifier::Stream stream;
+        stream.update(file.view().data(), file.size());
+        return stream.finish();
+    }
+
+    // Aplica fn a cada candidato no pool; quem falhar (lido/apagado no
+    // meio do caminho) sai da lista
+    template <class Fn>
+    void forEachParallel(ThreadPool& pool, std::vector<Candidate>& files,
+                         const std::vector<fs::path>& paths, Fn fn) {
+        std::vector<std::future<bool>> pending;
+        pending.reserve(files.size());
+        for (Candidate& file : files) {
+            pending.push_back(pool.enqueue([&file, &paths, &fn]() {
+                try {
+                    fn(paths[file.order], file);
+                    return true;
+                } catch (const std::exception&) {
+                    return false;
+                }
+            }));
+        }
+
+        size_t kept = 0;
+        for (size_t i = 0; i < files.size(); ++i) {
+            if (pending[i].get()) {
+                files[kept++] = std::move(files[i]);
+            }
+        }
+        files.resize(kept);
+    }
+
+    // Ordena por key e mantém só os trechos com 2+ elementos iguais
+    template <class Key>
+    void keepRepeated(std::vector<Candidate>& files, Key key) {
+        std::sort(files.begin(), files.end(), [&](const Candidate& a, const Candidate& b) {
+            auto keyA = key(a);
+            auto keyB = key(b);
+            return keyA != keyB ? keyA < keyB : a.order < b.order;
+        });
+
+        size_t kept = 0;
+        for (size_t begin = 0; begin < files.size();) {
+            size_t end = begin + 1;
+            while (end < files.size() && key(files[end]) == key(files[begin])) {
+                ++end;
+            }
+            if (end - begin > 1) {
+                for (size_t i = begin; i < end; ++i) {
+                    files[kept++] = std::move(files[i]);
+                }
+            }
+            begin = end;
+        }
+        files.resize(kept);
+    }
+
+    // Primeiro extent no mesmo lugar do disco e marcado como compartilhado:
+    // reflink de uma execução anterior, não há o que ganhar
+    bool sharesExtents(const fs::path& a, const fs::path& b) {
+#if defined(__linux__) && defined(FS_IOC_FIEMAP)
+        auto firstExtent = [](const fs::path& path, uint64_t& physical) {
+            int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+            if (fd < 0) {
+                return false;
+            }
+            alignas(struct fiemap) char buffer[sizeof(struct fiemap) + sizeof(struct fiemap_extent)] = {};
+            auto* map = reinterpret_cast<struct fiemap*>(buffer);
+            map->fm_length = FIEMAP_MAX_OFFSET;
+            map->fm_flags = FIEMAP_FLAG_SYNC;
+            map->fm_extent_count = 1;
+            bool ok = ::ioctl(fd, FS_IOC_FIEMAP, map) == 0 && map->fm_mapped_extents == 1 &&
+                      (map->fm_extents[0].fe_flags & FIEMAP_EXTENT_SHARED);
+            physical = map->fm_extents[0].fe_physical;
+            ::close(fd);
+            return ok;
+        };
+
+        uint64_t physicalA = 0;
+        uint64_t physicalB = 0;
+        return firstExtent(a, physicalA) && firstExtent(b, physicalB) && physicalA == physicalB;
+#else
+        (void)a;
+        (void)b;
+        return false;
+#endif
+    }
+}
+
+const char* dedupMethodName(DedupMethod method) {
+    switch (method) {
+        case DedupMethod::REFLINK:  return "reflink";
+        case DedupMethod::HARDLINK: return "hardlink";
+        default:                    return "none";
+    }
+}
+
+Deduplicator::Deduplicator(const DedupOptions& options) : options(options) {}
+
+DedupReport Deduplicator::run(const std::vector<fs::path>& files) {
+    DedupReport report;
+    report.filesScanned = files.size();
+
+    // 1. Tamanho (e dispositivo: entre discos não há como compartilhar)
+    std::vector<Candidate> candidates;
+    candidates.reserve(files.size());
+    for (size_t i = 0; i < files.size(); ++i) {
+        Candidate file;
+        file.order = i;
+        if (statFile(files[i], file) && file.size > 0) {
+            candidates.push_back(std::move(file));
+        }
+    }
+
+    // O mesmo inode por dois caminhos (hard link, caminho repetido) conta uma vez
+    std::sort(candidates.begin(), candidates.end(), [](const Candidate& a, const Candidate& b) {
+        return std::tie(a.device, a.inode, a.order) < std::tie(b.device, b.inode, b.order);
+    });
+    auto sameInode = [](const Candidate& a, const Candidate& b) {
+        return a.device == b.device && a.inode == b.inode;
+    };
+    auto uniqueEnd = std::unique(candidates.begin(), candidates.end(), sameInode);
+    report.alreadyShared += static_cast<size_t>(candidates.end() - uniqueEnd);
+    candidates.erase(uniqueEnd, candidates.end());
+
+    keepRepeated(candidates, [](const Candidate& f) { return std::make_pair(f.device, f.size); });
+    report.sizeCandidates = candidates.size();
+    if (candidates.empty()) {
+        return report;
+    }
+
+    ThreadPool pool(options.threads ? options.threads
+                                    : std::max(1u, std::thread::hardware_concurrency()));
+
+    // 2. Início + fim
+    forEachParallel(pool, candidates, files, [](const fs::path& path, Candidate& file) {
+        file.edgeCrc = edgeCrc(path);
+    });
+    keepRepeated(candidates, [](const Candidate& f) {
+        return std::make_tuple(f.device, f.size, f.edgeCrc);
+    });
+    report.hashCandidates = candidates.size();
+
+    // 3. Arquivo inteiro
+    forEachParallel(pool, candidates, files, [](const fs::path& path, Candidate& file) {
+        file.digests = fullDigests(path);
+        // Mudou desde o stat: o hash não descreve o arquivo com esse carimbo
+        if (stamp(path) != file.stamp) {
+            throw std::runtime_error("Arquivo mudou durante a leitura: " + path.string());
+        }
+    });
+    auto contentKey = [](const Candidate& f) {
+        return std::tie(f.device, f.size, f.digests.crc32, f.digests.sha1, f.digests.md5);
+    };
+    keepRepeated(candidates, contentKey);
+
+    // Cada grupo já está em ordem de entrada: o primeiro fica como original
+    for (size_t begin = 0; begin < candidates.size();) {
+        size_t end = begin + 1;
+        while (end < candidates.size() && contentKey(candidates[end]) == contentKey(candidates[begin])) {
+            ++end;
+        }
+
+        const fs::path& original = files[candidates[begin].order];
+        ++report.groups;
+        for (size_t i = begin + 1; i < end; ++i) {
+            const fs::path& duplicate = files[candidates[i].order];
+            const FileStamp& originalStamp = candidates[begin].stamp;
+            const FileStamp& duplicateStamp = candidates[i].stamp;
+            if (sharesExtents(original, duplicate)) {
+                ++report.alreadyShared;
+                continue;
+            }
+
+            DedupAction action;
+            action.original = original;
+            action.duplicate = duplicate;
+            action.size = candidates[i].size;
+            ++report.duplicates;
+
+            if (options.dryRun) {
+                report.reclaimedBytes += action.size;
+            } else {
+                try {
+                    action.method = replaceWithClone(original, duplicate, options.allowHardlinks,
+                                                     originalStamp, duplicateStamp);
+                    report.reclaimedBytes += action.size;
+                } catch (const std::exception& e) {
+                    action.error = e.what();
+                }
+            }
+            report.actions.push_back(std::move(action));
+        }
+        begin = end;
+    }
+
+    return report;
+}
+
+Deduplicator::FileStamp Deduplicator::stamp(const fs::path& file) {
+    FileStamp result;
+#ifndef _WIN32
+    struct stat info {};
+    if (::stat(file.c_str(), &info) != 0) {
+        throw std::runtime_error("Não foi possível ler: " + file.string());
+    }
+    result.size = static_cast<uint64_t>(info.st_size);
+#if defined(__APPLE__)
+    result.mtimeNs = static_cast<int64_t>(info.st_mtimespec.tv_sec) * 1000000000 +
+                     info.st_mtimespec.tv_nsec;
+#else
+    result.mtimeNs = static_cast<int64_t>(info.st_mtim.tv_sec) * 1000000000 +
+                     info.st_mtim.tv_nsec;
+#endif
+#else
+    result.size = fs::file_size(file);
+    result.mtimeNs = static_cast<int64_t>(fs::last_write_time(file).time_since_epoch().count());
+#endif
+    return result;
+}
+
+DedupMethod Deduplicator::replaceWithClone(const fs::path& original, const fs::path& duplicate,
+                                           bool allowHardlink,
+                                           const FileStamp& originalStamp,
+                                           const FileStamp& duplicateStamp) {
+#if defined(__linux__) && defined(FIDEDUPERANGE)
+    int source = ::open(original.c_str(), O_RDONLY | O_CLOEXEC);
+    if (source < 0) {
+        throw std::runtime_error("Não foi possível abrir: " + original.string());
+    }
+    // Escrita só para o kernel permitir o dedupe; nenhum byte é gravado
+    int target = ::open(duplicate.c_str(), O_WRONLY | O_CLOEXEC);
+    if (target < 0) {
+        ::close(source);
+        throw std::runtime_error("Não foi possível abrir: " + duplicate.string());
+    }
+
+    alignas(struct file_dedupe_range)
+        char buffer[sizeof(struct file_dedupe_range) + sizeof(struct file_dedupe_range_info)] = {};
+    auto* range = reinterpret_cast<struct file_dedupe_range*>(buffer);
+
+    // O kernel compara cada trecho com os dois intervalos travados:
+    // diferença (ou arquivo encurtado) nunca vira perda de dados
+    int error = 0;
+    bool differs = false;
+    uint64_t offset = 0;
+    while (offset < originalStamp.size) {
+        range->src_offset = offset;
+        range->src_length = std::min(originalStamp.size - offset, DEDUPE_STEP);
+        range->dest_count = 1;
+        range->info[0].dest_fd = target;
+        range->info[0].dest_offset = offset;
+        range->info[0].bytes_deduped = 0;
+        range->info[0].status = 0;
+
+        if (::ioctl(source, FIDEDUPERANGE, range) != 0) {
+            error = errno;
+            break;
+        }
+        if (range->info[0].status == FILE_DEDUPE_RANGE_DIFFERS) {
+            differs = true;
+            break;
+        }
+        if (range->info[0].status < 0) {
+            error = -range->info[0].status;
+            break;
+        }
+        if (range->info[0].bytes_deduped == 0) {
+            error = EIO;
+            break;
+        }
+        offset += range->info[0].bytes_deduped;
+    }
+    ::close(target);
+    ::close(source);
+
+    if (differs) {
+        throw std::runtime_error("Conteúdo mudou desde o hash, nada foi alterado: " +
+                                 duplicate.string());
+    }
+    if (error == 0) {
+        return DedupMethod::REFLINK;
+    }
+    // Sistema de arquivos sem reflink (ext4, tmpfs...) logo na primeira
+    // chamada; o resto (ou falha no meio) é erro de verdade
+    bool unsupported = offset == 0 && (error == EOPNOTSUPP || error == ENOTTY ||
+                                       error == EINVAL || error == EXDEV);
+    if (!unsupported) {
+        throw std::runtime_error("Erro ao clonar " + duplicate.string() + ": " +
+                                 std::strerror(error));
+    }
+#endif
+
+    if (!allowHardlink) {
+        throw std::runtime_error("Reflink não suportado neste sistema de arquivos: " +
+                                 duplicate.string());
+    }
+
+    // Sem comparação do kernel: pelo menos confere que nenhum dos dois
+    // mudou desde o hash
+    if (stamp(original) != originalStamp || stamp(duplicate) != duplicateStamp) {
+        throw std::runtime_error("Arquivo mudou desde o hash, nada foi alterado: " +
+                                 duplicate.string());
+    }
+
+    // Link ao lado e rename por cima: a duplicata nunca deixa de existir
+    fs::path temp = duplicate;
+    temp += ".dedup.tmp";
+    fs::create_hard_link(original, temp);
+    std::error_code ec;
+    fs::rename(temp, duplicate, ec);
+    if (ec) {
+        fs::remove(temp);
+        throw std::runtime_error("Erro ao substituir " + duplicate.string() + ": " + ec.message());
+    }
+    return DedupMethod::HARDLINK;
+}
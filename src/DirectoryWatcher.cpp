@@ -0,0 +1,309 @@
+#include "DirectoryWatcher.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+
+#ifdef __linux__
+    #include <sys/inotify.h>
+    #include <poll.h>
+    #include <unistd.h>
+#endif
+
+namespace {
+    // Intervalo máximo entre verificações do flag de parada
+    constexpr int POLL_INTERVAL_MS = 200;
+}
+
+DirectoryWatcher::DirectoryWatcher(const fs::path& directory,
+                                   const Settings& settings,
+                                   Filter filter)
+    : directory(directory), settings(settings), filter(std::move(filter)) {
+    if (this->settings.maxQueued == 0) {
+        this->settings.maxQueued = 1;
+    }
+}
+
+DirectoryWatcher::~DirectoryWatcher() {
+    stop();
+}
+
+bool DirectoryWatcher::isSupported() {
+#ifdef __linux__
+    return true;
+#else
+    return false;
+#endif
+}
+
+bool DirectoryWatcher::start() {
+#ifdef __linux__
+    if (running) {
+        return true;
+    }
+
+    if (!fs::is_directory(directory)) {
+        error = "Diretório não encontrado: " + directory.string();
+        return false;
+    }
+
+    inotifyFd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if (inotifyFd < 0) {
+        error = std::string("inotify_init1 falhou: ") + std::strerror(errno);
+        return false;
+    }
+
+    if (!addWatch(directory)) {
+        std::vector<std::string> failures = takeWarnings();
+        error = failures.empty() ? "inotify_add_watch falhou em " + directory.string()
+                                 : failures.back();
+        close(inotifyFd);
+        inotifyFd = -1;
+        return false;
+    }
+
+    if (settings.recursive) {
+        std::error_code ec;
+        for (auto it = fs::recursive_directory_iterator(directory, ec);
+             !ec && it != fs::recursive_directory_iterator(); it.increment(ec)) {
+            if (it->is_directory(ec)) {
+                addWatch(it->path());
+            }
+        }
+    }
+
+    running = true;
+    worker = std::thread([this]() { eventLoop(); });
+    return true;
+#else
+    error = "Monitoramento de diretório requer inotify (Linux)";
+    return false;
+#endif
+}
+
+void DirectoryWatcher::stop() {
+    running = false;
+    readyCondition.notify_all();
+    spaceCondition.notify_all();
+
+    if (worker.joinable()) {
+        worker.join();
+    }
+
+#ifdef __linux__
+    if (inotifyFd >= 0) {
+        close(inotifyFd);
+        inotifyFd = -1;
+    }
+#endif
+    watches.clear();
+}
+
+bool DirectoryWatcher::next(fs::path& file, std::chrono::milliseconds timeout) {
+    std::unique_lock<std::mutex> lock(queueMutex);
+
+    readyCondition.wait_for(lock, timeout, [this]() {
+        return !ready.empty() || !running;
+    });
+
+    if (ready.empty()) {
+        return false;
+    }
+
+    file = std::move(ready.front());
+    ready.pop_front();
+    queued.erase(file.string());
+
+    spaceCondition.notify_one();
+    return true;
+}
+
+// ==================== THREAD DE EVENTOS ====================
+void DirectoryWatcher::eventLoop() {
+#ifdef __linux__
+    int settleMs = static_cast<int>(settings.settleTime.count());
+
+    while (running) {
+        // Com arquivos pendentes, acorda a tempo de liberá-los
+        int timeout = pending.empty()
+                      ? POLL_INTERVAL_MS
+                      : std::clamp(settleMs / 4, 10, POLL_INTERVAL_MS);
+
+        pollfd pfd{inotifyFd, POLLIN, 0};
+        int result = poll(&pfd, 1, timeout);
+
+        if (result < 0 && errno != EINTR) {
+            error = std::string("poll falhou: ") + std::strerror(errno);
+            break;
+        }
+
+        if (result > 0 && (pfd.revents & POLLIN)) {
+            readEvents();
+        }
+
+        flushSettled();
+    }
+
+    running = false;
+    readyCondition.notify_all();
+#endif
+}
+
+std::vector<std::string> DirectoryWatcher::takeWarnings() {
+    std::lock_guard<std::mutex> lock(queueMutex);
+    std::vector<std::string> taken;
+    taken.swap(warnings);
+    return taken;
+}
+
+bool DirectoryWatcher::addWatch(const fs::path& dir) {
+#ifdef __linux__
+    uint32_t mask = IN_CLOSE_WRITE | IN_MOVED_TO | IN_MODIFY |
+                    IN_DELETE | IN_MOVED_FROM | IN_CREATE | IN_ONLYDIR;
+
+    int wd = inotify_add_watch(inotifyFd, dir.c_str(), mask);
+    if (wd < 0) {
+        // Subdiretório fora do monitoramento: quem usa precisa saber
+        // (ex.: ENOSPC = fs.inotify.max_user_watches)
+        std::string message = "inotify_add_watch falhou em " + dir.string() + ": " +
+                              std::strerror(errno);
+        std::lock_guard<std::mutex> lock(queueMutex);
+        if (warnings.size() < MAX_WARNINGS) {
+            warnings.push_back(std::move(message));
+        }
+        return false;
+    }
+    watches[wd] = dir;
+    return true;
+#else
+    (void)dir;
+    return false;
+#endif
+}
+
+void DirectoryWatcher::readEvents() {
+#ifdef __linux__
+    alignas(inotify_event) char buffer[64 * 1024];
+    auto now = std::chrono::steady_clock::now();
+
+    while (true) {
+        ssize_t length = read(inotifyFd, buffer, sizeof(buffer));
+        if (length <= 0) {
+            break; // EAGAIN: nada mais na fila do kernel
+        }
+
+        for (char* ptr = buffer; ptr < buffer + length;) {
+            const auto* event = reinterpret_cast<const inotify_event*>(ptr);
+            ptr += sizeof(inotify_event) + event->len;
+
+            if (event->mask & IN_Q_OVERFLOW) {
+                // Eventos perdidos: só um rescan garante que nada ficou para trás
+                overflows++;
+                rescan();
+                continue;
+            }
+
+            if (event->mask & IN_IGNORED) {
+                watches.erase(event->wd);
+                continue;
+            }
+
+            auto dirIt = watches.find(event->wd);
+            if (dirIt == watches.end() || event->len == 0) {
+                continue;
+            }
+
+            fs::path path = dirIt->second / event->name;
+
+            if (event->mask & IN_ISDIR) {
+                if (settings.recursive && (event->mask & (IN_CREATE | IN_MOVED_TO))) {
+                    addWatch(path);
+                    rescan(); // o diretório pode ter chegado já com arquivos
+                }
+                continue;
+            }
+
+            if (event->mask & (IN_DELETE | IN_MOVED_FROM)) {
+                pending.erase(path.string());
+            } else if (event->mask & (IN_CLOSE_WRITE | IN_MOVED_TO)) {
+                if (!filter || filter(path)) {
+                    pending[path.string()] = now;
+                }
+            } else if (event->mask & IN_MODIFY) {
+                // Ainda sendo escrito: reinicia a espera
+                auto it = pending.find(path.string());
+                if (it != pending.end()) {
+                    it->second = now;
+                }
+            }
+        }
+    }
+#endif
+}
+
+void DirectoryWatcher::flushSettled() {
+    auto now = std::chrono::steady_clock::now();
+
+    for (auto it = pending.begin(); it != pending.end() && running;) {
+        if (now - it->second >= settings.settleTime) {
+            fs::path file = it->first;
+            it = pending.erase(it);
+
+            std::error_code ec;
+            if (fs::is_regular_file(file, ec)) {
+                enqueue(file);
+            }
+        } else {
+            ++it;
+        }
+    }
+}
+
+void DirectoryWatcher::rescan() {
+    auto now = std::chrono::steady_clock::now();
+    std::error_code ec;
+
+    auto consider = [&](const fs::directory_entry& entry) {
+        std::error_code entryEc;
+        if (entry.is_directory(entryEc)) {
+            if (settings.recursive) {
+                addWatch(entry.path());
+            }
+        } else if (entry.is_regular_file(entryEc) && (!filter || filter(entry.path()))) {
+            pending.emplace(entry.path().string(), now);
+        }
+    };
+
+    if (settings.recursive) {
+        for (auto it = fs::recursive_directory_iterator(directory, ec);
+             !ec && it != fs::recursive_directory_iterator(); it.increment(ec)) {
+            consider(*it);
+        }
+    } else {
+        for (auto it = fs::directory_iterator(directory, ec);
+             !ec && it != fs::directory_iterator(); it.increment(ec)) {
+            consider(*it);
+        }
+    }
+}
+
+void DirectoryWatcher::enqueue(const fs::path& file) {
+    std::unique_lock<std::mutex> lock(queueMutex);
+
+    if (queued.count(file.string())) {
+        return;
+    }
+
+    // Fila cheia: segura a thread até o consumidor liberar espaço
+    spaceCondition.wait(lock, [this]() {
+        return ready.size() < settings.maxQueued || !running;
+    });
+
+    if (!running) {
+        return;
+    }
+
+    queued.insert(file.string());
+    ready.push_back(file);
+    readyCondition.notify_one();
+}
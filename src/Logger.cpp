@@ -46,8 +46,8 @@ Logger::Logger() : logLevel(LogLevel::INFO), logToFile(false) {
     }
 }
 
-void Logger::log(const std::string& message, LogLevel level) {
-    if (static_cast<int>(level) < static_cast<int>(logLevel)) {
+void Logger::log(std::string_view message, LogLevel level) {
+    if (!isEnabled(level)) {
         return;
     }
 
@@ -55,14 +55,16 @@ void Logger::log(const std::string& message, LogLevel level) {
     std::string levelStr = levelToString(level);
 
     // 🌍 Internacionalização
-    std::string displayMessage = message;
-    if (message.rfind("TR:", 0) == 0) { // começa com "TR:"
-        std::string key = message.substr(3);
-        displayMessage = LocalizationManager::instance().getString(key);
+    std::string_view displayMessage = message;
+    if (message.substr(0, 3) == "TR:") { // começa com "TR:"
+        displayMessage = LocalizationManager::instance().getString(message.substr(3));
     }
 
     std::string formatted =
-        "[" + timestamp + "] [" + levelStr + "] " + displayMessage;
+        "[" + timestamp + "] [" + levelStr + "] ";
+    formatted.append(displayMessage);
+
+    std::lock_guard<std::mutex> lock(logMutex);
 
     // Console
     outputToConsole(formatted, level);
@@ -146,6 +148,7 @@ void Logger::outputToConsole(const std::string& message, LogLevel level) {
 }
 
 std::vector<std::string> Logger::getRecentLogs(size_t count) const {
+    std::lock_guard<std::mutex> lock(logMutex);
     std::vector<std::string> result;
     size_t start = (logBuffer.size() > count) ? logBuffer.size() - count : 0;
     
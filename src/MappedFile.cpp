@@ -0,0 +1,201 @@
+#include "MappedFile.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#ifndef _WIN32
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+MappedFile::MappedFile(MappedFile&& other) noexcept {
+    *this = std::move(other);
+}
+
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept {
+    if (this != &other) {
+        close();
+        filePath = std::move(other.filePath);
+        fallback = std::move(other.fallback);
+        mapped = other.mapped;
+        length = other.length;
+        data = mapped ? other.data : fallback.data();
+
+        other.data = nullptr;
+        other.length = 0;
+        other.mapped = false;
+    }
+    return *this;
+}
+
+void MappedFile::open(const fs::path& path) {
+    close();
+    filePath = path;
+
+#ifndef _WIN32
+    int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        throw std::runtime_error("Não foi possível abrir: " + path.string());
+    }
+
+    struct stat info {};
+    if (::fstat(fd, &info) == 0 && S_ISREG(info.st_mode) && info.st_size > 0) {
+        void* address = ::mmap(nullptr, static_cast<size_t>(info.st_size),
+                               PROT_READ, MAP_PRIVATE, fd, 0);
+        if (address != MAP_FAILED) {
+            ::close(fd);
+            data = static_cast<const char*>(address);
+            length = static_cast<size_t>(info.st_size);
+            mapped = true;
+            return;
+        }
+    }
+    ::close(fd);
+#endif
+
+    // Fallback: leitura comum para o buffer reaproveitável
+    std::ifstream in(path, std::ios::binary | std::ios::ate);
+    if (!in.is_open()) {
+        throw std::runtime_error("Não foi possível abrir: " + path.string());
+    }
+
+    std::streamsize size = in.tellg();
+    if (size < 0) {
+        throw std::runtime_error("Erro ao ler: " + path.string());
+    }
+
+    fallback.resize(static_cast<size_t>(size));
+    in.seekg(0, std::ios::beg);
+    if (size > 0 && !in.read(&fallback[0], size)) {
+        throw std::runtime_error("Erro ao ler: " + path.string());
+    }
+
+    data = fallback.data();
+    length = fallback.size();
+}
+
+void MappedFile::close() {
+#ifndef _WIN32
+    if (mapped && data) {
+        ::munmap(const_cast<char*>(data), length);
+    }
+#endif
+    data = nullptr;
+    length = 0;
+    mapped = false;
+}
+
+void copyFileRegion(const fs::path& source, size_t offset, size_t length,
+                    const fs::path& target) {
+#ifdef __linux__
+    int inFd = ::open(source.c_str(), O_RDONLY | O_CLOEXEC);
+    int outFd = inFd < 0 ? -1 : ::open(target.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    size_t left = length;
+    if (inFd >= 0 && outFd >= 0) {
+        loff_t inOffset = static_cast<loff_t>(offset);
+        while (left > 0) {
+            ssize_t copied = ::copy_file_range(inFd, &inOffset, outFd, nullptr, left, 0);
+            if (copied <= 0) {
+                break;
+            }
+            left -= static_cast<size_t>(copied);
+        }
+    }
+    if (outFd >= 0) ::close(outFd);
+    if (inFd >= 0) ::close(inFd);
+    if (left == 0) {
+        return;
+    }
+    // Kernel antigo, sistemas de arquivos diferentes etc.: caminho portátil
+#endif
+
+    std::ifstream in(source, std::ios::binary);
+    std::ofstream out(target, std::ios::binary | std::ios::trunc);
+    if (!in.is_open() || !out.is_open()) {
+        throw std::runtime_error("Não foi possível copiar: " + source.string());
+    }
+
+    in.seekg(static_cast<std::streamoff>(offset), std::ios::beg);
+    std::vector<char> chunk(std::min<size_t>(length, 1024 * 1024));
+    for (size_t left = length; left > 0;) {
+        size_t step = std::min(chunk.size(), left);
+        if (!in.read(chunk.data(), static_cast<std::streamsize>(step)) ||
+            !out.write(chunk.data(), static_cast<std::streamsize>(step))) {
+            throw std::runtime_error("Erro ao copiar: " + source.string());
+        }
+        left -= step;
+    }
+}
+
+bool renameNoReplace(const fs::path& source, const fs::path& target) {
+#if defined(__linux__) && defined(RENAME_NOREPLACE)
+    if (::renameat2(AT_FDCWD, source.c_str(), AT_FDCWD, target.c_str(), RENAME_NOREPLACE) == 0) {
+        return true;
+    }
+    if (errno == EEXIST) {
+        return false;
+    }
+    if (errno != EINVAL && errno != ENOSYS) {
+        throw std::runtime_error("Erro ao renomear " + source.string() + ": " +
+                                 std::strerror(errno));
+    }
+    // Sistema de arquivos sem suporte à flag: tenta por hard link
+#endif
+
+#ifndef _WIN32
+    if (::link(source.c_str(), target.c_str()) == 0) {
+        ::unlink(source.c_str());
+        return true;
+    }
+    if (errno == EEXIST) {
+        return false;
+    }
+    // Sem hard links (FAT etc.): checagem simples, com a janela de sempre
+#endif
+
+    if (fs::exists(target)) {
+        return false;
+    }
+    fs::rename(source, target);
+    return true;
+}
+
+uint64_t punchFileHole(const fs::path& file, size_t offset, size_t length) {
+#if defined(__linux__) && defined(FALLOC_FL_PUNCH_HOLE)
+    int fd = ::open(file.c_str(), O_WRONLY | O_CLOEXEC);
+    if (fd < 0) {
+        throw std::runtime_error("Não foi possível abrir: " + file.string());
+    }
+
+    struct stat before {};
+    struct stat after {};
+    ::fstat(fd, &before);
+    int result = ::fallocate(fd, FALLOC_FL_PUNCH_HOLE | FALLOC_FL_KEEP_SIZE,
+                             static_cast<off_t>(offset), static_cast<off_t>(length));
+    int error = errno;
+    ::fstat(fd, &after);
+    ::close(fd);
+
+    if (result != 0) {
+        throw std::runtime_error("Não foi possível liberar blocos de " + file.string() + ": " +
+                                 std::strerror(error));
+    }
+    // st_blocks é sempre em unidades de 512 bytes
+    return before.st_blocks > after.st_blocks
+           ? static_cast<uint64_t>(before.st_blocks - after.st_blocks) * 512
+           : 0;
+#else
+    (void)offset;
+    (void)length;
+    throw std::runtime_error("Arquivos esparsos não suportados nesta plataforma: " +
+                             file.string());
+#endif
+}
@@ -0,0 +1,171 @@
+#include "N64ByteOrder.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <vector>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+    #include <immintrin.h>
+    #define ROMTRIMMER_X86_DISPATCH 1
+#endif
+
+N64ByteOrder detectN64ByteOrder(std::string_view head) {
+    if (head.size() < 4) {
+        return N64ByteOrder::UNKNOWN;
+    }
+    if (std::memcmp(head.data(), "\x80\x37\x12\x40", 4) == 0) return N64ByteOrder::Z64;
+    if (std::memcmp(head.data(), "\x37\x80\x40\x12", 4) == 0) return N64ByteOrder::V64;
+    if (std::memcmp(head.data(), "\x40\x12\x37\x80", 4) == 0) return N64ByteOrder::N64;
+    return N64ByteOrder::UNKNOWN;
+}
+
+namespace {
+
+using SwapKernel = void (*)(const char* src, char* dst, size_t words);
+
+// ==================== ESCALAR ====================
+
+void swap16Scalar(const char* src, char* dst, size_t words) {
+    for (size_t i = 0; i < words; ++i) {
+        char a = src[2 * i];
+        char b = src[2 * i + 1];
+        dst[2 * i] = b;
+        dst[2 * i + 1] = a;
+    }
+}
+
+void swap32Scalar(const char* src, char* dst, size_t words) {
+    for (size_t i = 0; i < words; ++i) {
+        uint32_t word;
+        std::memcpy(&word, src + 4 * i, 4);
+        word = (word >> 24) | ((word >> 8) & 0xFF00) |
+               ((word << 8) & 0xFF0000) | (word << 24);
+        std::memcpy(dst + 4 * i, &word, 4);
+    }
+}
+
+#ifdef ROMTRIMMER_X86_DISPATCH
+
+// ==================== SSSE3 / AVX2 ====================
+// Um pshufb por bloco; o resto cai no escalar.
+
+__attribute__((target("ssse3")))
+void swapSsse3(const char* src, char* dst, size_t size, __m128i mask) {
+    size_t i = 0;
+    for (; i + 16 <= size; i += 16) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_shuffle_epi8(v, mask));
+    }
+}
+
+__attribute__((target("avx2")))
+void swapAvx2(const char* src, char* dst, size_t size, __m256i mask) {
+    size_t i = 0;
+    for (; i + 32 <= size; i += 32) {
+        __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), _mm256_shuffle_epi8(v, mask));
+    }
+}
+
+__attribute__((target("ssse3")))
+void swap16Ssse3(const char* src, char* dst, size_t words) {
+    size_t size = words * 2;
+    swapSsse3(src, dst, size, _mm_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6,
+                                            9, 8, 11, 10, 13, 12, 15, 14));
+    size_t done = size & ~size_t(15);
+    swap16Scalar(src + done, dst + done, (size - done) / 2);
+}
+
+__attribute__((target("ssse3")))
+void swap32Ssse3(const char* src, char* dst, size_t words) {
+    size_t size = words * 4;
+    swapSsse3(src, dst, size, _mm_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4,
+                                            11, 10, 9, 8, 15, 14, 13, 12));
+    size_t done = size & ~size_t(15);
+    swap32Scalar(src + done, dst + done, (size - done) / 4);
+}
+
+__attribute__((target("avx2")))
+void swap16Avx2(const char* src, char* dst, size_t words) {
+    size_t size = words * 2;
+    swapAvx2(src, dst, size, _mm256_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6,
+                                              9, 8, 11, 10, 13, 12, 15, 14,
+                                              1, 0, 3, 2, 5, 4, 7, 6,
+                                              9, 8, 11, 10, 13, 12, 15, 14));
+    size_t done = size & ~size_t(31);
+    swap16Scalar(src + done, dst + done, (size - done) / 2);
+}
+
+__attribute__((target("avx2")))
+void swap32Avx2(const char* src, char* dst, size_t words) {
+    size_t size = words * 4;
+    swapAvx2(src, dst, size, _mm256_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4,
+                                              11, 10, 9, 8, 15, 14, 13, 12,
+                                              3, 2, 1, 0, 7, 6, 5, 4,
+                                              11, 10, 9, 8, 15, 14, 13, 12));
+    size_t done = size & ~size_t(31);
+    swap32Scalar(src + done, dst + done, (size - done) / 4);
+}
+
+#endif // ROMTRIMMER_X86_DISPATCH
+
+// Escolhe o kernel uma vez pela CPU em execução
+struct Kernels {
+    SwapKernel swap16 = swap16Scalar;
+    SwapKernel swap32 = swap32Scalar;
+
+    Kernels() {
+#ifdef ROMTRIMMER_X86_DISPATCH
+        if (__builtin_cpu_supports("avx2")) {
+            swap16 = swap16Avx2;
+            swap32 = swap32Avx2;
+        } else if (__builtin_cpu_supports("ssse3")) {
+            swap16 = swap16Ssse3;
+            swap32 = swap32Ssse3;
+        }
+#endif
+    }
+};
+
+const Kernels& kernels() {
+    static const Kernels instance;
+    return instance;
+}
+
+} // namespace
+
+void normalizeN64(const char* src, char* dst, size_t size, N64ByteOrder order) {
+    size_t done = 0;
+    if (order == N64ByteOrder::V64) {
+        kernels().swap16(src, dst, size / 2);
+        done = size & ~size_t(1);
+    } else if (order == N64ByteOrder::N64) {
+        kernels().swap32(src, dst, size / 4);
+        done = size & ~size_t(3);
+    }
+
+    if (dst != src && done < size) {
+        std::memcpy(dst + done, src + done, size - done);
+    }
+}
+
+void writeN64AsZ64(const std::filesystem::path& path, std::string_view data,
+                   N64ByteOrder order) {
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    if (!out) {
+        throw std::runtime_error("Não foi possível criar: " + path.string());
+    }
+
+    std::vector<char> chunk(std::min(data.size(), N64_STREAM_CHUNK));
+    for (size_t offset = 0; offset < data.size(); offset += chunk.size()) {
+        size_t length = std::min(chunk.size(), data.size() - offset);
+        normalizeN64(data.data() + offset, chunk.data(), length, order);
+        out.write(chunk.data(), static_cast<std::streamsize>(length));
+    }
+
+    if (!out.good()) {
+        throw std::runtime_error("Erro ao escrever: " + path.string());
+    }
+}
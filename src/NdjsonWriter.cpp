@@ -0,0 +1,88 @@
+#include "NdjsonWriter.hpp"
+
+#include <cerrno>
+
+#if defined(_WIN32)
+    #include <io.h>
+    #define WRITE_FD _write
+#else
+    #include <unistd.h>
+    #define WRITE_FD ::write
+#endif
+
+NdjsonWriter::NdjsonWriter(int fd, std::chrono::milliseconds flushInterval, size_t capacity)
+    : fd(fd), flushInterval(flushInterval), capacity(capacity) {
+    buffer.reserve(capacity + 1024);
+    if (flushInterval.count() > 0) {
+        flusher = std::thread(&NdjsonWriter::flusherLoop, this);
+    }
+}
+
+NdjsonWriter::~NdjsonWriter() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    wakeup.notify_all();
+    if (flusher.joinable()) {
+        flusher.join();
+    }
+    flush();
+}
+
+void NdjsonWriter::write(std::string_view record) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (writeFailed) {
+        return;
+    }
+
+    bool wasEmpty = buffer.empty();
+    buffer.append(record);
+    buffer += '\n';
+
+    if (buffer.size() >= capacity || flushInterval.count() <= 0) {
+        flushLocked();
+    } else if (wasEmpty) {
+        // Começa a contar o prazo deste lote
+        firstPending = std::chrono::steady_clock::now();
+        wakeup.notify_all();
+    }
+}
+
+void NdjsonWriter::flush() {
+    std::lock_guard<std::mutex> lock(mutex);
+    flushLocked();
+}
+
+void NdjsonWriter::flushLocked() {
+    size_t offset = 0;
+    while (offset < buffer.size() && !writeFailed) {
+        auto written = WRITE_FD(fd, buffer.data() + offset,
+                                static_cast<unsigned>(buffer.size() - offset));
+        if (written < 0) {
+            if (errno == EINTR) continue;
+            writeFailed = true;
+        } else {
+            offset += static_cast<size_t>(written);
+        }
+    }
+    buffer.clear();
+}
+
+void NdjsonWriter::flusherLoop() {
+    std::unique_lock<std::mutex> lock(mutex);
+    while (!stopping) {
+        // Ocioso: dorme até chegar um registro
+        if (buffer.empty()) {
+            wakeup.wait(lock, [this]() { return stopping || !buffer.empty(); });
+            continue;
+        }
+
+        // Alguém já descarregou (buffer cheio / flush()) antes do prazo
+        auto deadline = firstPending + flushInterval;
+        if (wakeup.wait_until(lock, deadline, [this]() { return stopping || buffer.empty(); })) {
+            continue;
+        }
+        flushLocked();
+    }
+}
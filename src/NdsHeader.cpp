@@ -0,0 +1,90 @@
+#include "NdsHeader.hpp"
+
+#include <algorithm>
+
+namespace {
+
+constexpr size_t NDS_HEADER_MIN = 0x200;
+constexpr size_t DOWNLOAD_PLAY_SIGNATURE_SIZE = 0x88;
+
+uint32_t readU32(std::string_view data, size_t offset) {
+    if (offset + 4 > data.size()) return 0;
+    return  static_cast<uint8_t>(data[offset]) |
+           (static_cast<uint8_t>(data[offset + 1]) << 8) |
+           (static_cast<uint8_t>(data[offset + 2]) << 16) |
+           (static_cast<uint32_t>(static_cast<uint8_t>(data[offset + 3])) << 24);
+}
+
+uint16_t readU16(std::string_view data, size_t offset) {
+    if (offset + 2 > data.size()) return 0;
+    return static_cast<uint16_t>(static_cast<uint8_t>(data[offset]) |
+                                 (static_cast<uint8_t>(data[offset + 1]) << 8));
+}
+
+// Tamanho do bloco de ícone/título pela versão
+size_t iconSize(uint16_t version) {
+    switch (version) {
+        case 0x0002: return 0x940;   // + chinês
+        case 0x0003: return 0xA40;   // + coreano
+        case 0x0103: return 0x23C0;  // DSi, ícone animado
+        default:     return 0x840;
+    }
+}
+
+} // namespace
+
+NdsLayout parseNdsLayout(std::string_view data) {
+    NdsLayout layout;
+    if (data.size() < NDS_HEADER_MIN) return layout;
+
+    size_t usedSize = readU32(data, 0x80);
+
+    // Unitcode com bit DSi: 0x210 inclui a área DSi
+    if ((static_cast<uint8_t>(data[0x12]) & 0x02) != 0) {
+        usedSize = std::max<size_t>(usedSize, readU32(data, 0x210));
+    }
+
+    // Header sem tamanho declarado (homebrew antigo): não dá para confiar
+    if (usedSize < NDS_HEADER_MIN) return layout;
+
+    size_t end = usedSize;
+    auto extend = [&end](size_t offset, size_t size) {
+        if (offset != 0 && size != 0) end = std::max(end, offset + size);
+    };
+
+    extend(readU32(data, 0x20), readU32(data, 0x2C));  // ARM9
+    extend(readU32(data, 0x30), readU32(data, 0x3C));  // ARM7
+    extend(readU32(data, 0x40), readU32(data, 0x44));  // FNT
+    extend(readU32(data, 0x48), readU32(data, 0x4C));  // FAT
+    extend(readU32(data, 0x50), readU32(data, 0x54));  // overlays ARM9
+    extend(readU32(data, 0x58), readU32(data, 0x5C));  // overlays ARM7
+    extend(0, readU32(data, 0x84));                    // header
+
+    size_t iconOffset = readU32(data, 0x68);
+    if (iconOffset != 0 && iconOffset + 2 <= data.size()) {
+        extend(iconOffset, iconSize(readU16(data, iconOffset)));
+    }
+
+    // FAT: pares (início, fim) de 32 bits por arquivo
+    size_t fatOffset = readU32(data, 0x48);
+    size_t fatSize = readU32(data, 0x4C);
+    if (fatOffset != 0 && fatOffset + fatSize <= data.size()) {
+        for (size_t entry = fatOffset; entry + 8 <= fatOffset + fatSize; entry += 8) {
+            uint32_t start = readU32(data, entry);
+            uint32_t stop = readU32(data, entry + 4);
+            if (stop > start) end = std::max<size_t>(end, stop);
+        }
+    }
+
+    // Assinatura RSA do download play ("ac") logo após o tamanho usado
+    if (usedSize + DOWNLOAD_PLAY_SIGNATURE_SIZE <= data.size() &&
+        data[usedSize] == 'a' && data[usedSize + 1] == 'c') {
+        layout.hasDownloadPlaySignature = true;
+        end = std::max(end, usedSize + DOWNLOAD_PLAY_SIGNATURE_SIZE);
+    }
+
+    layout.valid = true;
+    layout.usedSize = usedSize;
+    layout.dataEnd = end;
+    return layout;
+}
@@ -1,8 +1,15 @@
 #include "PaddingAnalyzer.hpp"
+#include "NdsHeader.hpp"
 #include <algorithm>
 #include <cmath>
 
-PaddingAnalysis PaddingAnalyzer::analyze(const std::string& data, 
+#if defined(__SSE2__)
+    #include <emmintrin.h>
+#elif defined(__aarch64__)
+    #include <arm_neon.h>
+#endif
+
+PaddingAnalysis PaddingAnalyzer::analyze(std::string_view data, 
                                         uint8_t paddingByte) {
     PaddingAnalysis result;
     result.hasPadding = false;
@@ -14,129 +21,381 @@ PaddingAnalysis PaddingAnalyzer::analyze(const std::string& data,
         return result;
     }
     
-    // Encontrar o último byte não-padding
-    size_t lastNonPadding = data.size() - 1;
-    while (lastNonPadding > 0 && static_cast<uint8_t>(data[lastNonPadding]) == paddingByte) {
-        --lastNonPadding;
+    TailProfile profile = profileTail(data, paddingByte);
+    size_t paddingBytes = data.size() - profile.paddingStart;
+    
+    // Nada de padding no fim, ou o arquivo inteiro é padding
+    if (paddingBytes == 0 || profile.paddingStart == 0) {
+        return result;
     }
     
-    // Se o último byte também é padding, todo o arquivo é padding?
-    if (static_cast<uint8_t>(data[lastNonPadding]) == paddingByte) {
-        result.hasPadding = false; // Arquivo inteiro é padding? Impossível
+    // FF/00 alternados colados no padding: sinal de dados (gráficos, tabelas)
+    if (profile.pattern.isAlternating) {
+        result.patternType = "alternating";
+        result.confidence = 0.3;
         return result;
     }
     
-    // Calcular quantos bytes de padding no final
-    size_t paddingBytes = data.size() - lastNonPadding - 1;
+    if (profile.otherPaddingRun >= MIXED_MIN_RUN) {
+        result.patternType = "mixed";
+    } else if (profile.pattern.isRepeating) {
+        result.patternType = "repeating";
+    }
     
-    if (paddingBytes == 0) {
-        return result;
+    result.confidence = confidenceFromProfile(profile, data.size());
+    result.hasPadding = true;
+    result.trimPoint = profile.paddingStart;
+    result.paddingSize = paddingBytes;
+    
+    // Arredondar para múltiplo de 4 (alinhamento comum)
+    if (result.trimPoint % 4 != 0) {
+        result.trimPoint += (4 - (result.trimPoint % 4));
+        if (result.trimPoint > data.size()) {
+            result.trimPoint = data.size();
+        }
     }
     
-    // Verificar se é padding "puro" (sequência contínua)
-    bool isPurePadding = true;
-    for (size_t i = lastNonPadding + 1; i < data.size(); ++i) {
+    return result;
+}
+
+PaddingAnalysis PaddingAnalyzer::analyze(std::string_view data,
+                                         uint8_t paddingByte,
+                                         RomType romType) {
+    if (romType == RomType::NDS) {
+        PaddingAnalysis result;
+        if (analyzeNdsHeader(data, paddingByte, result)) {
+            return result;
+        }
+    }
+    return analyze(data, paddingByte);
+}
+
+bool PaddingAnalyzer::analyzeNdsHeader(std::string_view data,
+                                       uint8_t paddingByte,
+                                       PaddingAnalysis& result) {
+    NdsLayout layout = parseNdsLayout(data);
+    if (!layout.valid) {
+        return false;
+    }
+
+    result.paddingByte = paddingByte;
+    result.trimPoint = data.size();
+
+    // Header declara mais do que o arquivo tem: já está trimado
+    if (layout.dataEnd >= data.size()) {
+        return true;
+    }
+
+    // Conferir só o começo e o fim da cauda; dados escondidos depois do
+    // tamanho declarado (saves anexados, hacks) caem na varredura completa
+    constexpr size_t CHECK_WINDOW = 64 * 1024;
+    size_t headEnd = std::min(data.size(), layout.dataEnd + CHECK_WINDOW);
+    size_t tailStart = std::max(layout.dataEnd, data.size() - std::min(data.size(), CHECK_WINDOW));
+
+    if (!validatePaddingRegion(data, layout.dataEnd, headEnd, paddingByte) ||
+        !validatePaddingRegion(data, tailStart, data.size(), paddingByte)) {
+        return false;
+    }
+
+    result.hasPadding = true;
+    result.trimPoint = layout.dataEnd;
+    result.paddingSize = data.size() - layout.dataEnd;
+    result.confidence = 0.95;
+    result.patternType = "header";
+    return true;
+}
+
+bool PaddingAnalyzer::validatePaddingRegion(std::string_view data,
+                                            size_t start,
+                                            size_t end,
+                                            uint8_t paddingByte) {
+    end = std::min(end, data.size());
+    for (size_t i = start; i < end; ++i) {
         if (static_cast<uint8_t>(data[i]) != paddingByte) {
-            isPurePadding = false;
-            break;
+            return false;
         }
     }
+    return true;
+}
+
+PaddingAnalysis PaddingAnalyzer::analyzeAuto(std::string_view data, 
+                                            RomType romType) {
+    if (data.empty()) {
+        return analyze(data, 0xFF);
+    }
     
-    if (!isPurePadding) {
-        // Padding interrompido - pode ser dados válidos
-        return result;
+    uint8_t candidate = static_cast<uint8_t>(data.back());
+    if (excludedFromAuto(candidate, romType)) {
+        // Como antes da varredura única: o GBA em auto só corta 0xFF
+        return analyze(data, 0xFF, romType);
     }
+    PaddingAnalysis result = analyze(data, candidate, romType);
     
-    // Verificar padrões alternados (sinal de possíveis dados)
-    if (hasAlternatingPattern(data, paddingByte)) {
-        result.confidence = 0.3;
-        return result;
+    if (result.hasPadding && result.paddingSize < minimumPaddingFor(candidate)) {
+        // Poucos bytes iguais no fim: mais provável que sejam dados
+        PaddingAnalysis none;
+        none.trimPoint = data.size();
+        return none;
+    }
+    return result;
+}
+
+uint8_t PaddingAnalyzer::autoDetectPadding(std::string_view data, 
+                                          RomType romType) {
+    if (data.empty()) {
+        return 0xFF;
     }
     
-    // Calcular confiança baseada no tamanho do padding
-    double paddingRatio = static_cast<double>(paddingBytes) / data.size();
+    uint8_t candidate = static_cast<uint8_t>(data.back());
+    if (excludedFromAuto(candidate, romType)) {
+        return 0xFF;
+    }
+    size_t needed = minimumPaddingFor(candidate);
+    if (needed == 0) {
+        return candidate;
+    }
+    
+    return data.size() >= needed &&
+           validatePaddingRegion(data, data.size() - needed, data.size(), candidate)
+           ? candidate : 0xFF;
+}
+
+bool PaddingAnalyzer::excludedFromAuto(uint8_t paddingByte, RomType romType) const {
+    // ROMs GBA usam 0xFF; zeros no fim costumam ser dados (--padding-byte
+    // 0x00 continua cortando quando o usuário pede)
+    return romType == RomType::GBA && paddingByte == 0x00;
+}
+
+size_t PaddingAnalyzer::minimumPaddingFor(uint8_t paddingByte) const {
+    if (paddingByte == 0xFF || paddingByte == 0x00) {
+        return 0;
+    }
+    return MIN_OTHER_PADDING;
+}
+
+bool PaddingAnalyzer::hasAlternatingPattern(std::string_view data, 
+                                           uint8_t paddingByte) {
+    // FF 00 FF 00 / 00 FF 00 FF logo antes do padding (ou no fim do arquivo)
+    return profileTail(data, paddingByte).pattern.isAlternating;
+}
+
+bool PaddingAnalyzer::hasMixedPadding(std::string_view data) {
+    if (data.empty()) {
+        return false;
+    }
+    
+    // Ex.: dados, 0x00 de preenchimento e só então 0xFF até o fim
+    uint8_t last = static_cast<uint8_t>(data.back());
+    if (last != 0x00 && last != 0xFF) {
+        return false;
+    }
+    return profileTail(data, last).otherPaddingRun >= MIXED_MIN_RUN;
+}
+
+double PaddingAnalyzer::calculatePaddingConfidence(std::string_view data, 
+                                                  uint8_t paddingByte, 
+                                                  size_t paddingStart) {
+    TailProfile profile = profileTail(data, paddingByte);
+    
+    // Corte antes do fim real dos dados
+    if (paddingStart < profile.paddingStart || paddingStart >= data.size()) {
+        return 0.0;
+    }
+    if (profile.pattern.isAlternating) {
+        return 0.3;
+    }
+    return confidenceFromProfile(profile, data.size());
+}
+
+// ==================== PERFIL DA CAUDA ====================
+
+PaddingAnalyzer::TailProfile PaddingAnalyzer::profileTail(std::string_view data,
+                                                          uint8_t paddingByte) {
+    TailProfile profile;
+    profile.paddingByte = paddingByte;
+    profile.paddingStart = findTrueEndOfData(data, paddingByte);
+    profile.windowStart = profile.paddingStart -
+                          std::min(profile.paddingStart, PROFILE_WINDOW);
+    
+    // Janela antes do padding, de trás para frente: histograma e runs
+    const uint8_t otherByte = paddingByte == 0xFF ? 0x00 : 0xFF;
+    size_t run = 0;
+    size_t runEnd = profile.paddingStart;
+    uint8_t runByte = 0;
+    
+    auto closeRun = [&]() {
+        if (run >= MIN_RUN) {
+            profile.paddingRuns++;
+            profile.longestRun = std::max(profile.longestRun, run);
+            if (runEnd == profile.paddingStart && runByte == otherByte) {
+                profile.otherPaddingRun = run;
+            }
+        }
+        run = 0;
+    };
+    
+    for (size_t i = profile.paddingStart; i > profile.windowStart; --i) {
+        uint8_t byte = static_cast<uint8_t>(data[i - 1]);
+        profile.histogram[byte]++;
+        
+        if (run > 0 && byte == runByte) {
+            run++;
+            continue;
+        }
+        closeRun();
+        if (byte == 0x00 || byte == 0xFF) {
+            run = 1;
+            runByte = byte;
+            runEnd = i;
+        }
+    }
+    closeRun();
+    
+    profile.pattern = analyzePattern(data, profile.windowStart, profile.paddingStart);
+    return profile;
+}
+
+double PaddingAnalyzer::confidenceFromProfile(const TailProfile& profile,
+                                              size_t totalSize) {
+    size_t paddingBytes = totalSize - profile.paddingStart;
+    double paddingRatio = static_cast<double>(paddingBytes) / totalSize;
+    double confidence;
     
     // Padding muito pequeno (menos de 1KB) pode ser intencional
     if (paddingBytes < 1024) {
-        result.confidence = 0.5;
+        confidence = 0.5;
     }
     // Padding muito grande (mais de 50%) é suspeito
     else if (paddingRatio > 0.5) {
-        result.confidence = 0.7;
+        confidence = 0.7;
     }
     else {
-        result.confidence = 0.9;
+        confidence = 0.9;
     }
     
-    // Ajustar confiança baseado no tipo de ROM
-    result.confidence = adjustConfidenceForRomType(result.confidence, 
-                                                  paddingBytes, data.size());
-    
-    result.hasPadding = true;
-    result.trimPoint = lastNonPadding + 1;
-    result.paddingSize = paddingBytes;
-    
-    // Arredondar para múltiplo de 4 (alinhamento comum)
-    if (result.trimPoint % 4 != 0) {
-        result.trimPoint += (4 - (result.trimPoint % 4));
-        if (result.trimPoint > data.size()) {
-            result.trimPoint = data.size();
+    size_t window = profile.paddingStart - profile.windowStart;
+    if (window > 0) {
+        // Dados esparsos antes do corte: o fim real é menos claro
+        if (profile.histogram[profile.paddingByte] * 2 > window) {
+            confidence -= 0.1;
         }
+        // Ilha de dados depois de um buraco grande (save anexado, lixo)
+        if (profile.longestRun >= 4096) {
+            confidence -= 0.1;
+        }
+    }
+    if (profile.pattern.isRepeating) {
+        confidence -= 0.2;
+    }
+    if (profile.otherPaddingRun >= MIXED_MIN_RUN) {
+        confidence -= 0.1;
     }
     
-    return result;
+    confidence = std::max(confidence, 0.0);
+    return adjustConfidenceForRomType(confidence, paddingBytes, totalSize);
 }
 
-uint8_t PaddingAnalyzer::autoDetectPadding(const std::string& data, 
-                                          RomType romType) {
-    // Contar ocorrências de 0xFF e 0x00 nos últimos 1KB
-    size_t sampleSize = std::min<size_t>(data.size(), 1024);
-    size_t ffCount = 0;
-    size_t zeroCount = 0;
+size_t PaddingAnalyzer::findTrueEndOfData(std::string_view data, uint8_t paddingByte) {
+    const char* bytes = data.data();
+    size_t end = data.size();
     
-    for (size_t i = data.size() - sampleSize; i < data.size(); ++i) {
-        if (static_cast<uint8_t>(data[i]) == 0xFF) ffCount++;
-        if (static_cast<uint8_t>(data[i]) == 0x00) zeroCount++;
-    }
-    
-    // ROMs GBA geralmente usam 0xFF, algumas DS usam 0x00
-    if (romType == RomType::GBA) {
-        return 0xFF;
+    // 64 bytes por iteração enquanto tudo for padding
+#if defined(__SSE2__)
+    const __m128i target = _mm_set1_epi8(static_cast<char>(paddingByte));
+    while (end >= 64) {
+        const char* block = bytes + end - 64;
+        __m128i eq = _mm_and_si128(
+            _mm_and_si128(
+                _mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(block)), target),
+                _mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(block + 16)), target)),
+            _mm_and_si128(
+                _mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(block + 32)), target),
+                _mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(block + 48)), target)));
+        if (_mm_movemask_epi8(eq) != 0xFFFF) {
+            break;
+        }
+        end -= 64;
     }
-    else if (romType == RomType::NDS) {
-        // DS pode usar ambos, mas 0xFF é mais comum
-        return (ffCount > zeroCount) ? 0xFF : 0x00;
+#elif defined(__aarch64__)
+    const uint8x16_t target = vdupq_n_u8(paddingByte);
+    while (end >= 64) {
+        const uint8_t* block = reinterpret_cast<const uint8_t*>(bytes + end - 64);
+        uint8x16_t eq = vandq_u8(
+            vandq_u8(vceqq_u8(vld1q_u8(block), target), vceqq_u8(vld1q_u8(block + 16), target)),
+            vandq_u8(vceqq_u8(vld1q_u8(block + 32), target), vceqq_u8(vld1q_u8(block + 48), target)));
+        if (vminvq_u8(eq) != 0xFF) {
+            break;
+        }
+        end -= 64;
     }
+#endif
     
-    // Padrão geral: usar o que aparecer mais
-    return (ffCount > zeroCount) ? 0xFF : 0x00;
+    // Resto (e o bloco que quebrou) byte a byte
+    while (end > 0 && static_cast<uint8_t>(bytes[end - 1]) == paddingByte) {
+        --end;
+    }
+    return end;
 }
 
-bool PaddingAnalyzer::hasAlternatingPattern(const std::string& data, 
-                                           uint8_t paddingByte) {
-    // Verificar padrões como FF 00 FF 00 ou 00 FF 00 FF
-    size_t checkSize = std::min<size_t>(data.size(), 256);
+PaddingAnalyzer::PatternResult PaddingAnalyzer::analyzePattern(std::string_view data,
+                                                              size_t start,
+                                                              size_t end) {
+    PatternResult result;
+    constexpr size_t MAX_PERIOD = 16;
+    constexpr size_t MIN_SPAN = 32;
     
-    if (checkSize < 4) return false;
+    end = std::min(end, data.size());
+    if (start >= end || end - start < MIN_SPAN) {
+        return result;
+    }
     
-    uint8_t alternate1 = paddingByte;
-    uint8_t alternate2 = (paddingByte == 0xFF) ? 0x00 : 0xFF;
+    // span[p]: bytes seguidos (de end para trás) com x[i] == x[i + p].
+    // Para assim que nenhum período sobrevive, então dados comuns custam
+    // só alguns bytes
+    size_t span[MAX_PERIOD + 1] = {};
+    bool alive[MAX_PERIOD + 1] = {};
+    size_t aliveCount = 0;
+    for (size_t p = 1; p <= MAX_PERIOD && p < end - start; ++p) {
+        alive[p] = true;
+        aliveCount++;
+    }
     
-    bool pattern1 = true; // alternate1, alternate2, alternate1, alternate2...
-    bool pattern2 = true; // alternate2, alternate1, alternate2, alternate1...
+    for (size_t i = end - 1; i > start && aliveCount > 0; --i) {
+        size_t pos = i - 1;
+        for (size_t p = 1; p <= MAX_PERIOD; ++p) {
+            if (!alive[p] || pos + p >= end) {
+                continue;
+            }
+            if (data[pos] == data[pos + p]) {
+                span[p]++;
+            } else {
+                alive[p] = false;
+                aliveCount--;
+            }
+        }
+    }
     
-    for (size_t i = data.size() - checkSize; i < data.size(); ++i) {
-        size_t pos = i - (data.size() - checkSize);
-        uint8_t expected1 = (pos % 2 == 0) ? alternate1 : alternate2;
-        uint8_t expected2 = (pos % 2 == 0) ? alternate2 : alternate1;
+    // Menor período que se repete pelo menos 4 vezes
+    for (size_t p = 1; p <= MAX_PERIOD; ++p) {
+        size_t covered = span[p] + p;
+        if (covered < std::max(MIN_SPAN, 4 * p)) {
+            continue;
+        }
         
-        if (static_cast<uint8_t>(data[i]) != expected1) pattern1 = false;
-        if (static_cast<uint8_t>(data[i]) != expected2) pattern2 = false;
+        result.patternLength = p;
+        result.span = covered;
         
-        if (!pattern1 && !pattern2) break;
+        uint8_t a = static_cast<uint8_t>(data[end - 1]);
+        uint8_t b = static_cast<uint8_t>(data[end - 2]);
+        if (p == 2 && ((a == 0xFF && b == 0x00) || (a == 0x00 && b == 0xFF))) {
+            result.isAlternating = true;
+        } else if (p > 1 || (a != 0x00 && a != 0xFF)) {
+            // Run de 0x00/0xFF é padding misto, não padrão
+            result.isRepeating = true;
+        }
+        break;
     }
-    
-    return pattern1 || pattern2;
+    return result;
 }
 
 double PaddingAnalyzer::adjustConfidenceForRomType(double baseConfidence, 
@@ -5,8 +5,8 @@
 #include <cstring>
 
 std::vector<uint8_t> ReversePadding::createRestorationPatch(
-    const std::string& originalData,
-    const std::string& trimmedData,
+    std::string_view originalData,
+    std::string_view trimmedData,
     uint8_t paddingByte) {
     
     std::vector<uint8_t> patch;
@@ -51,11 +51,11 @@ std::vector<uint8_t> ReversePadding::createRestorationPatch(
 }
 
 std::string ReversePadding::applyRestorationPatch(
-    const std::string& trimmedData,
+    std::string_view trimmedData,
     const std::vector<uint8_t>& patch) {
     
     if (patch.size() < sizeof(uint32_t) + 1 + sizeof(uint32_t)) {
-        return trimmedData; // Invalid patch
+        return std::string(trimmedData); // Invalid patch
     }
     
     const uint8_t* ptr = patch.data();
@@ -64,7 +64,7 @@ std::string ReversePadding::applyRestorationPatch(
     ptr += sizeof(magic);
     
     if (magic != PATCH_MAGIC) {
-        return trimmedData; // Invalid magic
+        return std::string(trimmedData); // Invalid magic
     }
     
     uint8_t paddingByte = *ptr++;
@@ -73,8 +73,55 @@ std::string ReversePadding::applyRestorationPatch(
     ptr += sizeof(paddingSize);
     
     // Create restored data
-    std::string restored = trimmedData;
+    std::string restored(trimmedData);
     restored.append(paddingSize, static_cast<char>(paddingByte));
     
     return restored;
 }
+
+std::string ReversePadding::restorePaddingSimple(
+    std::string_view trimmedData,
+    size_t originalSize,
+    uint8_t paddingByte) {
+    
+    std::string restored(trimmedData);
+    if (originalSize > restored.size()) {
+        restored.append(originalSize - restored.size(), static_cast<char>(paddingByte));
+    }
+    return restored;
+}
+
+bool ReversePadding::savePatch(const std::vector<uint8_t>& patch,
+                              const std::string& filename) {
+    if (patch.empty()) {
+        return false;
+    }
+    
+    std::ofstream file(filename, std::ios::binary | std::ios::trunc);
+    if (!file) {
+        return false;
+    }
+    
+    file.write(reinterpret_cast<const char*>(patch.data()),
+               static_cast<std::streamsize>(patch.size()));
+    return file.good();
+}
+
+std::vector<uint8_t> ReversePadding::loadPatch(const std::string& filename) {
+    std::ifstream file(filename, std::ios::binary | std::ios::ate);
+    if (!file) {
+        return {};
+    }
+    
+    std::streamsize size = file.tellg();
+    if (size <= 0) {
+        return {};
+    }
+    
+    std::vector<uint8_t> patch(static_cast<size_t>(size));
+    file.seekg(0, std::ios::beg);
+    if (!file.read(reinterpret_cast<char*>(patch.data()), size)) {
+        return {};
+    }
+    return patch;
+}
@@ -1,137 +1,218 @@
 #include "RomDetector.hpp"
+#include "SnesHeader.hpp"
 
+#include <algorithm>
 #include <string>
 #include <cstddef>
-#include <cstdint>   // 👈 O CARA QUE TAVA FALTANDO
+#include <cstdint>
 #include <cstring>
+#include <fstream>
 
-RomType RomDetector::detect(const std::string& data) {
-    if (data.size() < 192) { // Tamanho mínimo para header
-        return RomType::UNKNOWN;
+namespace {
+
+// ==================== LEITURA DO HEADER ====================
+
+uint8_t byteAt(std::string_view data, size_t offset) {
+    return static_cast<uint8_t>(data[offset]);
+}
+
+uint16_t readU16(std::string_view data, size_t offset) {
+    return static_cast<uint16_t>(byteAt(data, offset) | (byteAt(data, offset + 1) << 8));
+}
+
+uint32_t readU32(std::string_view data, size_t offset) {
+    return  byteAt(data, offset) |
+           (byteAt(data, offset + 1) << 8) |
+           (byteAt(data, offset + 2) << 16) |
+           (static_cast<uint32_t>(byteAt(data, offset + 3)) << 24);
+}
+
+bool hasBytes(std::string_view data, size_t offset, const void* bytes, size_t size) {
+    return data.size() >= offset + size &&
+           std::memcmp(data.data() + offset, bytes, size) == 0;
+}
+
+// Logo Nintendo: 0x04 no GBA, 0xC0 no NDS
+const uint8_t NINTENDO_LOGO[] = {
+    0x24, 0xFF, 0xAE, 0x51, 0x69, 0x9A, 0xA2, 0x21, 0x3D, 0x84, 0x82, 0x0A,
+    0x84, 0xE4, 0x09, 0xAD, 0x11, 0x24, 0x8B, 0x98, 0xC0, 0x81, 0x7F, 0x21,
+    0xA3, 0x52, 0xBE, 0x19, 0x93, 0x09, 0xCE, 0x20, 0x10, 0x46, 0x4A, 0x4A,
+    0xF8, 0x27, 0x31, 0xEC, 0x58, 0xC7, 0xE8, 0x33, 0x82, 0xE3, 0xCE, 0xBF,
+    0x85, 0xF4, 0xDF, 0x94, 0xCE, 0x4B, 0x09, 0xC1, 0x94, 0x56, 0x8A, 0xC0,
+    0x13, 0x72, 0xA7, 0xFC, 0x9F, 0x84, 0x4D, 0x73, 0xA3, 0xCA, 0x9A, 0x61,
+    0x58, 0x97, 0xA3, 0x27, 0xFC, 0x03, 0x98, 0x76, 0x23, 0x1D, 0xC7, 0x61,
+    0x03, 0x04, 0xAE, 0x56, 0xBF, 0x38, 0x84, 0x00, 0x40, 0xA7, 0x0E, 0xFD,
+    0xFF, 0x52, 0xFE, 0x03, 0x6F, 0x95, 0x30, 0xF1, 0x97, 0xFB, 0xC0, 0x85,
+    0x60, 0xD6, 0x80, 0x25, 0xA9, 0x63, 0xBE, 0x03, 0x01, 0x4E, 0x38, 0xE2,
+    0xF9, 0xA2, 0x34, 0xFF, 0xBB, 0x3E, 0x03, 0x44, 0x78, 0x00, 0x90, 0xCB,
+    0x88, 0x11, 0x3A, 0x94, 0x65, 0xC0, 0x7C, 0x63, 0x87, 0xF0, 0x3C, 0xAF,
+    0xD6, 0x25, 0xE4, 0x8B, 0x38, 0x0A, 0xAC, 0x72, 0x21, 0xD4, 0xF8, 0x07
+};
+
+// Logo Nintendo do Game Boy em 0x104
+const uint8_t GB_LOGO[] = {
+    0xCE, 0xED, 0x66, 0x66, 0xCC, 0x0D, 0x00, 0x0B, 0x03, 0x73, 0x00, 0x83,
+    0x00, 0x0C, 0x00, 0x0D, 0x00, 0x08, 0x11, 0x1F, 0x88, 0x89, 0x00, 0x0E,
+    0xDC, 0xCC, 0x6E, 0xE6, 0xDD, 0xDD, 0xD9, 0x99, 0xBB, 0xBB, 0x67, 0x63,
+    0x6E, 0x0E, 0xEC, 0xCC, 0xDD, 0xDC, 0x99, 0x9F, 0xBB, 0xB9, 0x33, 0x3E
+};
+
+// CRC-16/MODBUS, o mesmo do header NDS (0x15E)
+uint16_t crc16(std::string_view data) {
+    uint16_t crc = 0xFFFF;
+    for (char c : data) {
+        crc ^= static_cast<uint8_t>(c);
+        for (int bit = 0; bit < 8; ++bit) {
+            crc = (crc & 1) ? static_cast<uint16_t>((crc >> 1) ^ 0xA001)
+                            : static_cast<uint16_t>(crc >> 1);
+        }
     }
-    
-    // Verificar GBA
-    if (isGbaRom(data)) {
+    return crc;
+}
+
+// ==================== ASSINATURAS ====================
+
+RomType matchGba(std::string_view head, size_t) {
+    if (hasBytes(head, 0x04, NINTENDO_LOGO, sizeof(NINTENDO_LOGO))) {
         return RomType::GBA;
     }
-    
-    // Verificar NDS
-    if (isNdsRom(data)) {
-        return RomType::NDS;
+
+    // Sem logo (homebrew): valor fixo 0x96 + complemento do header
+    if (head.size() < 0xC0 || byteAt(head, 0xB2) != 0x96) {
+        return RomType::UNKNOWN;
+    }
+    uint8_t check = 0;
+    for (size_t i = 0xA0; i <= 0xBC; ++i) {
+        check = static_cast<uint8_t>(check - byteAt(head, i));
+    }
+    check = static_cast<uint8_t>(check - 0x19);
+    return check == byteAt(head, 0xBD) ? RomType::GBA : RomType::UNKNOWN;
+}
+
+RomType matchNds(std::string_view head, size_t) {
+    if (head.size() < 0x200) {
+        return RomType::UNKNOWN;
     }
-    
-    // Verificar GB/GBC
-    if (isGbRom(data)) {
-        return RomType::GB;
+    if (hasBytes(head, 0xC0, NINTENDO_LOGO, sizeof(NINTENDO_LOGO)) ||
+        crc16(head.substr(0, 0x15E)) == readU16(head, 0x15E)) {
+        return RomType::NDS;
     }
-    
     return RomType::UNKNOWN;
 }
 
-bool RomDetector::isGbaRom(const std::string& data) {
-    // Logo Nintendo em 0x04 - 0x9F
-    const uint8_t nintendoLogo[] = {
-        0x24, 0xFF, 0xAE, 0x51, 0x69, 0x9A, 0xA2, 0x21, 0x3D, 0x84, 0x82, 0x0A,
-        0x84, 0xE4, 0x09, 0xAD, 0x11, 0x24, 0x8B, 0x98, 0xC0, 0x81, 0x7F, 0x21,
-        0xA3, 0x52, 0xBE, 0x19, 0x93, 0x09, 0xCE, 0x20, 0x10, 0x46, 0x4A, 0x4A,
-        0xF8, 0x27, 0x31, 0xEC, 0x58, 0xC7, 0xE8, 0x33, 0x82, 0xE3, 0xCE, 0xBF,
-        0x85, 0xF4, 0xDF, 0x94, 0xCE, 0x4B, 0x09, 0xC1, 0x94, 0x56, 0x8A, 0xC0,
-        0x13, 0x72, 0xA7, 0xFC, 0x9F, 0x84, 0x4D, 0x73, 0xA3, 0xCA, 0x9A, 0x61,
-        0x58, 0x97, 0xA3, 0x27, 0xFC, 0x03, 0x98, 0x76, 0x23, 0x1D, 0xC7, 0x61,
-        0x03, 0x04, 0xAE, 0x56, 0xBF, 0x38, 0x84, 0x00, 0x40, 0xA7, 0x0E, 0xFD,
-        0xFF, 0x52, 0xFE, 0x03, 0x6F, 0x95, 0x30, 0xF1, 0x97, 0xFB, 0xC0, 0x85,
-        0x60, 0xD6, 0x80, 0x25, 0xA9, 0x63, 0xBE, 0x03, 0x01, 0x4E, 0x38, 0xE2,
-        0xF9, 0xA2, 0x34, 0xFF, 0xBB, 0x3E, 0x03, 0x44, 0x78, 0x00, 0x90, 0xCB,
-        0x88, 0x11, 0x3A, 0x94, 0x65, 0xC0, 0x7C, 0x63, 0x87, 0xF0, 0x3C, 0xAF,
-        0xD6, 0x25, 0xE4, 0x8B, 0x38, 0x0A, 0xAC, 0x72, 0x21, 0xD4, 0xF8, 0x07
-    };
-    
-    if (memcmp(&data[0x04], nintendoLogo, sizeof(nintendoLogo)) == 0) {
-        return true;
+RomType matchGameBoy(std::string_view head, size_t) {
+    if (!hasBytes(head, 0x104, GB_LOGO, sizeof(GB_LOGO)) || head.size() < 0x150) {
+        return RomType::UNKNOWN;
     }
-    
-    // Verificar tamanho típico de ROMs GBA (potências de 2)
-    size_t size = data.size();
-    if (size >= 1024 * 1024 && size <= 32 * 1024 * 1024) {
-        // Verificar se termina com 0xFF ou 0x00 (comum em ROMs GBA)
-        size_t lastNonPadding = findLastNonPadding(data, 0xFF);
-        if (lastNonPadding < size) {
-            // Tamanho após trim seria potência de 2?
-            size_t trimmedSize = lastNonPadding + 1;
-            if (isPowerOfTwo(trimmedSize) || 
-                (trimmedSize % (1024 * 1024) == 0)) {
-                return true;
-            }
+    // Flag CGB: 0x80 = compatível, 0xC0 = só Color
+    return (byteAt(head, 0x143) & 0x80) ? RomType::GBC : RomType::GB;
+}
+
+RomType matchNes(std::string_view head, size_t) {
+    // iNES e NES 2.0 (byte 7 & 0x0C == 0x08) compartilham a assinatura
+    return hasBytes(head, 0, "NES\x1A", 4) ? RomType::NES : RomType::UNKNOWN;
+}
+
+RomType matchN64(std::string_view head, size_t) {
+    static const uint8_t magics[][4] = {
+        {0x80, 0x37, 0x12, 0x40},   // .z64 big-endian
+        {0x37, 0x80, 0x40, 0x12},   // .v64 byte-swapped
+        {0x40, 0x12, 0x37, 0x80}    // .n64 little-endian
+    };
+    for (const auto& magic : magics) {
+        if (hasBytes(head, 0, magic, sizeof(magic))) {
+            return RomType::N64;
         }
     }
-    
-    return false;
+    return RomType::UNKNOWN;
+}
+
+RomType matchMegaDrive(std::string_view head, size_t) {
+    // "SEGA MEGA DRIVE" / "SEGA GENESIS"; alguns dumps começam em 0x101
+    return hasBytes(head, 0x100, "SEGA", 4) || hasBytes(head, 0x101, "SEGA", 4)
+           ? RomType::MEGADRIVE : RomType::UNKNOWN;
 }
 
-bool RomDetector::isNdsRom(const std::string& data) {
-    if (data.size() < 512) {
-        return false;
+RomType matchSnes(std::string_view head, size_t fileSize) {
+    // LoROM/HiROM, com ou sem header de copiadora
+    return parseSnesLayout(head, fileSize).valid ? RomType::SNES : RomType::UNKNOWN;
+}
+
+RomType matchNdsOffsets(std::string_view head, size_t fileSize) {
+    // Homebrew antigo sem logo nem CRC: offsets ARM9/ARM7 plausíveis
+    if (head.size() < 0x200) {
+        return RomType::UNKNOWN;
     }
-    
-    // Verificar assinatura "Nintendo DS" no header
-    const char* ndsSignature = "Nintendo DS";
-    if (memcmp(&data[0x0C], ndsSignature, 12) == 0) {
-        return true;
+    uint32_t arm9Offset = readU32(head, 0x20);
+    uint32_t arm7Offset = readU32(head, 0x30);
+    bool plausible = arm9Offset >= 0x200 && arm9Offset < fileSize && arm9Offset % 4 == 0 &&
+                     arm7Offset >= 0x200 && arm7Offset < fileSize && arm7Offset % 4 == 0;
+    return plausible ? RomType::NDS : RomType::UNKNOWN;
+}
+
+struct Signature {
+    const char* name;
+    RomType (*match)(std::string_view head, size_t fileSize);
+};
+
+// Ordem importa: assinaturas exatas primeiro, heurísticas por último
+const Signature SIGNATURES[] = {
+    {"GBA",        matchGba},
+    {"NDS",        matchNds},
+    {"GB/GBC",     matchGameBoy},
+    {"NES",        matchNes},
+    {"N64",        matchN64},
+    {"Mega Drive", matchMegaDrive},
+    {"SNES",       matchSnes},
+    {"NDS (offsets)", matchNdsOffsets}
+};
+
+} // namespace
+
+RomType RomDetector::detect(std::string_view data) {
+    return detectHeader(data.substr(0, HEADER_WINDOW), data.size());
+}
+
+RomType RomDetector::detectHeader(std::string_view head, size_t fileSize) {
+    if (head.size() < 192) { // Tamanho mínimo para header
+        return RomType::UNKNOWN;
     }
-    
-    // Verificar offsets ARM9/ARM7
-    uint32_t arm9Offset, arm7Offset;
-    
-    // Extrair os 4 bytes do offset (little-endian)
-    arm9Offset = static_cast<uint8_t>(data[0x20]) |
-                 (static_cast<uint8_t>(data[0x21]) << 8) |
-                 (static_cast<uint8_t>(data[0x22]) << 16) |
-                 (static_cast<uint8_t>(data[0x23]) << 24);
-    
-    arm7Offset = static_cast<uint8_t>(data[0x30]) |
-                 (static_cast<uint8_t>(data[0x31]) << 8) |
-                 (static_cast<uint8_t>(data[0x32]) << 16) |
-                 (static_cast<uint8_t>(data[0x33]) << 24);
-    
-    if (arm9Offset < data.size() && arm7Offset < data.size()) {
-        // Offsets devem ser múltiplos de 4
-        if (arm9Offset % 4 == 0 && arm7Offset % 4 == 0) {
-            return true;
+
+    for (const Signature& signature : SIGNATURES) {
+        RomType type = signature.match(head, fileSize);
+        if (type != RomType::UNKNOWN) {
+            return type;
         }
     }
-    
-    return false;
+    return RomType::UNKNOWN;
+}
+
+// ==================== PRÉ-CLASSIFICAÇÃO ====================
+
+RomDetector::Probe RomDetector::probe(std::string_view head, size_t fileSize) {
+    Probe result;
+    result.type = detectHeader(head, fileSize);
+    result.worthReading = result.type != RomType::UNKNOWN;
+    return result;
 }
 
-bool RomDetector::isGbRom(const std::string& data) {
-    if (data.size() < 0x150) {
-        return false;
+RomDetector::Probe RomDetector::probeFile(const std::filesystem::path& file) {
+    std::ifstream in(file, std::ios::binary | std::ios::ate);
+    if (!in.is_open()) {
+        // Quem abrir o arquivo de verdade reporta o erro
+        return {RomType::UNKNOWN, true};
     }
-    
-    // Verificar logo Nintendo (GB/GBC)
-    const uint8_t gbLogo[] = {
-        0xCE, 0xED, 0x66, 0x66, 0xCC, 0x0D, 0x00, 0x0B, 0x03, 0x73, 0x00, 0x83,
-        0x00, 0x0C, 0x00, 0x0D, 0x00, 0x08, 0x11, 0x1F, 0x88, 0x89, 0x00, 0x0E,
-        0xDC, 0xCC, 0x6E, 0xE6, 0xDD, 0xDD, 0xD9, 0x99, 0xBB, 0xBB, 0x67, 0x63,
-        0x6E, 0x0E, 0xEC, 0xCC, 0xDD, 0xDC, 0x99, 0x9F, 0xBB, 0xB9, 0x33, 0x3E
-    };
-    
-    if (memcmp(&data[0x104], gbLogo, sizeof(gbLogo)) == 0) {
-        return true;
+
+    std::streamoff size = in.tellg();
+    if (size <= 0) {
+        return {};
     }
-    
-    return false;
-}
 
-size_t RomDetector::findLastNonPadding(const std::string& data, uint8_t padding) {
-    for (size_t i = data.size(); i > 0; --i) {
-        if (static_cast<uint8_t>(data[i - 1]) != padding) {
-            return i - 1;
-        }
+    std::string head(static_cast<size_t>(std::min<std::streamoff>(size, HEADER_WINDOW)), '\0');
+    in.seekg(0, std::ios::beg);
+    if (!in.read(&head[0], static_cast<std::streamsize>(head.size()))) {
+        return {RomType::UNKNOWN, true};
     }
-    return 0;
-}
 
-bool RomDetector::isPowerOfTwo(size_t n) {
-    return (n != 0) && ((n & (n - 1)) == 0);
-}
\ No newline at end of file
+    return probe(head, static_cast<size_t>(size));
+}
@@ -1,16 +1,26 @@
 #include "RomTrimmer.hpp"
 #include "Localization.hpp"
+#include "DirectoryWatcher.hpp"
+#include "TrimService.hpp"
+#include "JsonWriter.hpp"
+#include "SnesHeader.hpp"
+#include "Deduplicator.hpp"
+#include "ChunkIndex.hpp"
+#include "TrimEngine.hpp"
 #include <zlib.h>
 #include "ValidationResult.hpp" // ou outro header onde a struct é definida
 #include <iostream>
 #include <fstream>
 #include <sstream>
 #include <iomanip>
+#include <cstdio>
 #include <cstring>
 #include <algorithm>
 #include <stdexcept>
 #include <memory>
 #include <thread>
+#include <unordered_map>
+#include <csignal>
 
 // ==================== CONSTRUTOR ====================
 RomTrimmer::RomTrimmer()
@@ -42,6 +52,32 @@ void RomTrimmer::run(int argc, char** argv)
             return;
         }
 
+        // Modo --serve: atende requisições num socket Unix
+        if (!serveSocket.empty())
+        {
+            runServeMode();
+            cleanup();
+            return;
+        }
+
+        // Modo --chunk-unpack: remonta um pack, sem -p
+        if (!chunkUnpackPath.empty())
+        {
+            runChunkUnpackMode();
+            cleanup();
+            return;
+        }
+
+        // Modo --watch: fica residente processando o que chegar
+        if (!watchDir.empty())
+        {
+            startProcessing();
+            runWatchMode();
+            resultWriter ? emitSummaryRecord() : printSummary();
+            cleanup();
+            return;
+        }
+
         // 4. Validar que temos inputs para processar
         if (options.inputPaths.empty())
         {
@@ -55,7 +91,23 @@ void RomTrimmer::run(int argc, char** argv)
         // 6. Coletar arquivos para processamento
         if (!collectFiles())
         {
-            logger->log(TR("NO_INPUT"), LogLevel::ERROR);
+            LOG_ERROR(*logger, TR("NO_INPUT"));
+            return;
+        }
+
+        // Modo --dedup: mesmos arquivos coletados, nada é trimado
+        if (dedupMode)
+        {
+            runDedupMode();
+            cleanup();
+            return;
+        }
+
+        // Modo --chunk-report: só mede, nada é alterado
+        if (chunkReportMode)
+        {
+            runChunkReportMode();
+            cleanup();
             return;
         }
 
@@ -63,7 +115,7 @@ void RomTrimmer::run(int argc, char** argv)
         processFiles();
 
         // 8. Exibir resumo final
-        printSummary();
+        resultWriter ? emitSummaryRecord() : printSummary();
 
         // 9. Limpar recursos
         cleanup();
@@ -75,7 +127,7 @@ void RomTrimmer::run(int argc, char** argv)
     }
     catch (...)
     {
-        handleCriticalError(TR("UNKNOWN_ERROR"));
+        handleCriticalError(std::string(TR("UNKNOWN_ERROR")));
     }
 }
 
@@ -88,7 +140,7 @@ void RomTrimmer::initializeConfiguration()
     // Aplicar configurações padrão
     applyDefaultConfiguration();
 
-    logger->log(TR("START_MSG"), LogLevel::INFO);
+    LOG_INFO(*logger, TR("START_MSG"));
 }
 
 void RomTrimmer::applyDefaultConfiguration()
@@ -120,7 +172,7 @@ bool RomTrimmer::parseArguments(int argc, char** argv)
 {
     try
     {
-        cxxopts::Options opts("romtrimmer++", TR("A_POWERFUL_ROM_TRIMMING_UTILITY"));
+        cxxopts::Options opts("romtrimmer++", std::string(TR("A_POWERFUL_ROM_TRIMMING_UTILITY")));
 
         // Definir todas as opções disponíveis
         defineCommandLineOptions(opts);
@@ -155,7 +207,7 @@ bool RomTrimmer::parseArguments(int argc, char** argv)
         // Aplicar configurações de verbosidade
         if (options.verbose)
         {
-            logger->log("Verbose mode enabled", LogLevel::DEBUG);
+            LOG_DEBUG(*logger, "Verbose mode enabled");
         }
 
         return true;
@@ -178,9 +230,9 @@ void RomTrimmer::defineCommandLineOptions(cxxopts::Options& opts)
 {
     opts.add_options()
     // Opções de entrada
-    ("i,input", TR("INPUT_HELP"), cxxopts::value<std::vector<std::string>>())
-    ("p,path", TR("PATH_HELP"), cxxopts::value<std::string>())
-    ("r,recursive", TR("RECURSIVE_HELP"))
+    ("i,input", std::string(TR("INPUT_HELP")), cxxopts::value<std::vector<std::string>>())
+    ("p,path", std::string(TR("PATH_HELP")), cxxopts::value<std::string>())
+    ("r,recursive", std::string(TR("RECURSIVE_HELP")))
 
     // Nova opção para extensões personalizadas
     ("e,extensions", "Extensões personalizadas (ex: nds,gba,nes,smc)",
@@ -196,15 +248,15 @@ void RomTrimmer::defineCommandLineOptions(cxxopts::Options& opts)
 
 
     // Opções de saída
-    ("o,output", TR("OUTPUT_HELP"), cxxopts::value<std::string>())
+    ("o,output", std::string(TR("OUTPUT_HELP")), cxxopts::value<std::string>())
 
     // Modos de operação
-    ("a,analyze", TR("ANALYSIS_MODE"))
-    ("d,dry-run", TR("SIMULATION_MODE"))
-    ("f,force", TR("FORCE_HELP"))
+    ("a,analyze", std::string(TR("ANALYSIS_MODE")))
+    ("d,dry-run", std::string(TR("SIMULATION_MODE")))
+    ("f,force", std::string(TR("FORCE_HELP")))
 
     // Configurações
-    ("b,no-backup", TR("NO_BACKUP_HELP"))
+    ("b,no-backup", std::string(TR("NO_BACKUP_HELP")))
     ("padding-byte", "Padrão de padding (0xFF, 0x00, auto)",
      cxxopts::value<std::string>()->default_value("auto"))
     ("min-size", "Tamanho mínimo em bytes",
@@ -213,13 +265,18 @@ void RomTrimmer::defineCommandLineOptions(cxxopts::Options& opts)
      cxxopts::value<size_t>()->default_value("65536"))
     ("max-cut-ratio", "Porcentagem máxima de corte (0.0-1.0)",
      cxxopts::value<double>()->default_value("0.6"))
+    ("normalize-n64", "Gravar ROMs N64 .v64/.n64 na ordem .z64")
+    ("strip-copier-header", "Gravar ROMs SNES sem o header de copiadora (512 bytes)")
+    ("sparse", "Manter o tamanho e só desalocar o padding 0x00 (punch hole)")
 
     // Informação e debug
-    ("v,verbose", TR("VERBOSE_HELP"))
-    ("h,help", TR("HELP_HELP"))
-    ("version", TR("VERSION_HELP"))
+    ("v,verbose", std::string(TR("VERBOSE_HELP")))
+    ("h,help", std::string(TR("HELP_HELP")))
+    ("version", std::string(TR("VERSION_HELP")))
     ("log-file", "Arquivo de log para saída detalhada",
      cxxopts::value<std::string>())
+    ("format", "Formato dos resultados em stdout (text, ndjson)",
+     cxxopts::value<std::string>()->default_value("text"))
 
     // Processar extensões personalizadas
 
@@ -233,7 +290,34 @@ void RomTrimmer::defineCommandLineOptions(cxxopts::Options& opts)
      cxxopts::value<std::string>()->default_value("zip"))
     ("rezip-level", "Nível de compressão (0-9)",
      cxxopts::value<int>()->default_value("5"))
-    ("keep-original", "Manter arquivo original após rezip");
+    ("keep-original", "Manter arquivo original após rezip")
+
+    // Monitoramento de diretório
+    ("watch", "Monitorar diretório e processar novas ROMs (Linux/inotify)",
+     cxxopts::value<std::string>())
+    ("watch-settle", "Milissegundos sem escrita antes de processar um arquivo",
+     cxxopts::value<int>()->default_value("500"))
+    ("watch-queue", "Máximo de arquivos prontos aguardando processamento",
+     cxxopts::value<size_t>()->default_value("1024"))
+
+    // Serviço residente
+    ("serve", "Atender requisições analyze/trim/verify num socket Unix",
+     cxxopts::value<std::string>())
+    ("dat", "Arquivo DAT carregado pelo --serve para o comando verify",
+     cxxopts::value<std::string>())
+
+    // Deduplicação
+    ("dedup", "Trocar ROMs idênticas por reflinks do primeiro arquivo (FIDEDUPERANGE)")
+    ("dedup-hardlinks", "No --dedup, usar hard links onde não houver reflink")
+
+    // Análise de chunks (FastCDC)
+    ("chunk-report", "Medir economia de armazenamento com dedup por chunks entre as ROMs")
+    ("chunk-size", "Tamanho médio dos chunks do --chunk-report (potência de 2)",
+     cxxopts::value<uint32_t>()->default_value("8192"))
+    ("chunk-pack", "Gravar os chunks únicos + manifesto neste arquivo (implica --chunk-report)",
+     cxxopts::value<std::string>())
+    ("chunk-unpack", "Remontar os arquivos de um pack do --chunk-pack em -o (ou no diretório atual)",
+     cxxopts::value<std::string>());
 }
 
 
@@ -246,6 +330,15 @@ void RomTrimmer::processCommandLineOptions(const cxxopts::ParseResult& result)
     options.force       = result.count("force") > 0;
     options.verbose     = result.count("verbose") > 0;
     options.backup      = result.count("no-backup") == 0; // Invertido
+    options.normalizeN64 = result.count("normalize-n64") > 0;
+    options.stripCopierHeader = result.count("strip-copier-header") > 0;
+    options.sparse = result.count("sparse") > 0;
+
+    // Verbose libera mensagens DEBUG no logger
+    if (options.verbose)
+    {
+        logger->setLogLevel(LogLevel::DEBUG);
+    }
 
     // Caminhos de entrada
     if (result.count("input"))
@@ -317,8 +410,10 @@ void RomTrimmer::processCommandLineOptions(const cxxopts::ParseResult& result)
         int threads = result["threads"].as<int>();
         if (threads < 1)
         {
-            logger->log("Número de threads inválido, usando 1", LogLevel::WARNING);
+            LOG_WARNING(*logger, "Número de threads inválido, usando 1");
+            threads = 1;
         }
+        threadCount = static_cast<size_t>(threads);
     }
     if (result.count("extensions"))
     {
@@ -351,7 +446,7 @@ void RomTrimmer::processCommandLineOptions(const cxxopts::ParseResult& result)
     if (result.count("rezip"))
     {
         rezipAfterTrim = true;
-        logger->log("Rezip habilitado", LogLevel::INFO);
+        LOG_INFO(*logger, "Rezip habilitado");
     }
 
     if (result.count("rezip-format"))
@@ -359,7 +454,7 @@ void RomTrimmer::processCommandLineOptions(const cxxopts::ParseResult& result)
         rezipFormat = result["rezip-format"].as<std::string>();
         if (rezipFormat != "zip" && rezipFormat != "7z" && rezipFormat != "tar.gz")
         {
-            logger->log("Formato de recompactação inválido, usando ZIP", LogLevel::WARNING);
+            LOG_WARNING(*logger, "Formato de recompactação inválido, usando ZIP");
             rezipFormat = "zip";
         }
     }
@@ -371,6 +466,57 @@ void RomTrimmer::processCommandLineOptions(const cxxopts::ParseResult& result)
     }
 
     keepOriginalAfterRezip = result.count("keep-original") > 0;
+
+    // ==================== WATCH ====================
+    if (result.count("watch"))
+    {
+        watchDir = result["watch"].as<std::string>();
+    }
+
+    watchSettleMs = std::max(0, result["watch-settle"].as<int>());
+    watchQueueSize = std::max<size_t>(1, result["watch-queue"].as<size_t>());
+
+    // ==================== SERVE ====================
+    if (result.count("serve"))
+    {
+        serveSocket = result["serve"].as<std::string>();
+    }
+
+    if (result.count("dat"))
+    {
+        datPath = result["dat"].as<std::string>();
+    }
+
+    // ==================== DEDUP ====================
+    dedupMode = result.count("dedup") > 0;
+    dedupHardlinks = result.count("dedup-hardlinks") > 0;
+
+    // ==================== CHUNKS ====================
+    if (result.count("chunk-pack"))
+    {
+        chunkPackPath = result["chunk-pack"].as<std::string>();
+    }
+    chunkReportMode = result.count("chunk-report") > 0 || !chunkPackPath.empty();
+    chunkAverageSize = result["chunk-size"].as<uint32_t>();
+    if (result.count("chunk-unpack"))
+    {
+        chunkUnpackPath = result["chunk-unpack"].as<std::string>();
+    }
+
+    // ==================== FORMATO DE SAÍDA ====================
+    std::string format = result["format"].as<std::string>();
+    if (format == "ndjson")
+    {
+        // main() já mandou std::cout para stderr; os registros vão direto
+        // no fd 1. No --watch cada registro sai na hora
+        resultWriter = std::make_unique<NdjsonWriter>(
+            1, watchDir.empty() ? std::chrono::milliseconds(100)
+                                : std::chrono::milliseconds(0));
+    }
+    else if (format != "text")
+    {
+        throw std::runtime_error("Formato de saída inválido: " + format);
+    }
 }
 
 bool RomTrimmer::validateOptions()
@@ -382,16 +528,34 @@ bool RomTrimmer::validateOptions()
         return false;
     }
 
+    // --sparse não reescreve bytes: conversões que mudam o conteúdo não cabem
+    if (options.sparse && (options.normalizeN64 || options.stripCopierHeader))
+    {
+        std::cerr << "--sparse não combina com --normalize-n64 nem --strip-copier-header"
+                  << std::endl;
+        return false;
+    }
+
+    // O ChunkIndex só corta com médias potência de 2 dentro dos limites
+    if (chunkAverageSize < ChunkIndex::MIN_AVERAGE_SIZE ||
+        chunkAverageSize > ChunkIndex::MAX_AVERAGE_SIZE ||
+        (chunkAverageSize & (chunkAverageSize - 1)) != 0)
+    {
+        std::cerr << "--chunk-size deve ser potência de 2 entre "
+                  << ChunkIndex::MIN_AVERAGE_SIZE << " e " << ChunkIndex::MAX_AVERAGE_SIZE
+                  << ": " << chunkAverageSize << std::endl;
+        return false;
+    }
+
     // Validar limites de segurança
     if (options.maxCutRatio > 0.9 && !options.force)
     {
-        logger->log(TR("HIGH_CUT_RATIO_WARNING"), LogLevel::WARNING);
+        LOG_WARNING(*logger, TR("HIGH_CUT_RATIO_WARNING"));
     }
 
     if (options.minSize < 1024)
     {
-        logger->log("Tamanho mínimo muito pequeno, ajustando para 1024 bytes",
-                    LogLevel::WARNING);
+        LOG_WARNING(*logger, "Tamanho mínimo muito pequeno, ajustando para 1024 bytes");
         options.minSize = 1024;
     }
 
@@ -409,7 +573,7 @@ bool RomTrimmer::collectFiles()
         {
             if (!fs::exists(inputPath))
             {
-                logger->log(TR("PATH_NOT_EXIST") + inputPath.string(), LogLevel::ERROR);
+                LOG_ERROR(*logger, std::string(TR("PATH_NOT_EXIST")) + inputPath.string());
                 continue;
             }
 
@@ -420,8 +584,8 @@ bool RomTrimmer::collectFiles()
                 {
                     if (!processCompressedArchive(inputPath, allFiles))
                     {
-                        logger->log("Falha ao processar arquivo compactado: " +
-                                    inputPath.string(), LogLevel::ERROR);
+                        LOG_ERROR(*logger, "Falha ao processar arquivo compactado: " +
+                                           inputPath.string());
                     }
                     continue;
                 }
@@ -435,8 +599,7 @@ bool RomTrimmer::collectFiles()
                 {
                     if (!customExtensions.empty())
                     {
-                        logger->log("Extensão não suportada: " + inputPath.string(),
-                                    LogLevel::WARNING);
+                        LOG_WARNING(*logger, "Extensão não suportada: " + inputPath.string());
                     }
                 }
             }
@@ -449,8 +612,8 @@ bool RomTrimmer::collectFiles()
         }
         catch (const fs::filesystem_error& e)
         {
-            logger->log("Erro ao acessar caminho " + inputPath.string() +
-                        ": " + e.what(), LogLevel::ERROR);
+            LOG_ERROR(*logger, "Erro ao acessar caminho " + inputPath.string() +
+                               ": " + e.what());
         }
     }
 
@@ -461,19 +624,21 @@ bool RomTrimmer::collectFiles()
     // Remover duplicatas e ordenar
     removeDuplicatesAndSort(allFiles);
 
-    // Atualizar lista de arquivos
+    // Atualizar lista de arquivos (as entradas originais viram as raízes
+    // dos nomes no --chunk-pack)
+    inputRoots = options.inputPaths;
     options.inputPaths = allFiles;
 
     // Log do resultado
-    logger->log(std::to_string(allFiles.size()) + TR("FILES_FOUND"),
-                LogLevel::INFO);
+    LOG_INFO(*logger, std::to_string(allFiles.size()) + std::string(TR("FILES_FOUND")));
 
-    if (options.verbose && !allFiles.empty())
+    // Listagem por arquivo só é montada se DEBUG estiver ativo
+    if (logger->isEnabled(LogLevel::DEBUG) && !allFiles.empty())
     {
-        logger->log("Arquivos a processar:", LogLevel::DEBUG);
+        LOG_DEBUG(*logger, "Arquivos a processar:");
         for (const auto& file : allFiles)
         {
-            logger->log("  - " + file.string(), LogLevel::DEBUG);
+            LOG_DEBUG(*logger, "  - " + file.string());
         }
     }
 
@@ -497,8 +662,8 @@ void RomTrimmer::collectFilesFromDirectory(const fs::path& dir,
                     {
                         if (!processCompressedArchive(entry.path(), allFiles))
                         {
-                            logger->log("Falha ao processar arquivo compactado: " +
-                                        entry.path().string(), LogLevel::ERROR);
+                            LOG_ERROR(*logger, "Falha ao processar arquivo compactado: " +
+                                               entry.path().string());
                         }
                         continue;
                     }
@@ -523,8 +688,8 @@ void RomTrimmer::collectFilesFromDirectory(const fs::path& dir,
                     {
                         if (!processCompressedArchive(entry.path(), allFiles))
                         {
-                            logger->log("Falha ao processar arquivo compactado: " +
-                                        entry.path().string(), LogLevel::ERROR);
+                            LOG_ERROR(*logger, "Falha ao processar arquivo compactado: " +
+                                               entry.path().string());
                         }
                         continue;
                     }
@@ -540,8 +705,8 @@ void RomTrimmer::collectFilesFromDirectory(const fs::path& dir,
     }
     catch (const fs::filesystem_error& e)
     {
-        logger->log("Erro ao acessar diretório " + dir.string() +
-                    ": " + e.what(), LogLevel::ERROR);
+        LOG_ERROR(*logger, "Erro ao acessar diretório " + dir.string() +
+                           ": " + e.what());
     }
 }
 
@@ -584,9 +749,8 @@ void RomTrimmer::removeDuplicatesAndSort(std::vector<fs::path>& files)
 // ==================== PROCESSAMENTO DE ARQUIVOS ====================
 void RomTrimmer::processFiles()
 {
-    logger->log("Iniciando processamento de " +
-                std::to_string(options.inputPaths.size()) + " arquivos...",
-                LogLevel::INFO);
+    LOG_INFO(*logger, "Iniciando processamento de " +
+                      std::to_string(options.inputPaths.size()) + " arquivos...");
 
     // Processamento sequencial (pode ser estendido para paralelo)
     for (const auto& filePath : options.inputPaths)
@@ -603,57 +767,449 @@ void RomTrimmer::processFiles()
         // Verificar se houve erro crítico que deve parar o processamento
         if (filesFailed > 10 && !options.force)
         {
-            logger->log("Muitos erros ocorreram, abortando processamento",
-                        LogLevel::ERROR);
+            LOG_ERROR(*logger, "Muitos erros ocorreram, abortando processamento");
             break;
         }
     }
 }
 
+// ==================== MODOS RESIDENTES ====================
+namespace
+{
+    // Ctrl+C / SIGTERM encerram --watch e --serve de forma limpa
+    volatile std::sig_atomic_t stopRequested = 0;
+
+    extern "C" void onStopSignal(int)
+    {
+        stopRequested = 1;
+    }
+}
+
+void RomTrimmer::runServeMode()
+{
+    size_t threads = threadCount ? threadCount
+                                 : std::max(1u, std::thread::hardware_concurrency());
+
+    TrimService service(options, *logger, threads);
+
+    if (!datPath.empty() && !service.loadDat(datPath))
+    {
+        return;
+    }
+
+    stopRequested = 0;
+    auto previousInt = std::signal(SIGINT, onStopSignal);
+    auto previousTerm = std::signal(SIGTERM, onStopSignal);
+
+    service.serve(serveSocket, []() { return stopRequested != 0; });
+
+    std::signal(SIGINT, previousInt);
+    std::signal(SIGTERM, previousTerm);
+}
+
+void RomTrimmer::runDedupMode()
+{
+    DedupOptions dedupOptions;
+    dedupOptions.dryRun = options.dryRun;
+    dedupOptions.allowHardlinks = dedupHardlinks;
+    dedupOptions.threads = threadCount;
+
+    // inputPaths já vem ordenado do collectFiles: o primeiro de cada grupo fica
+    Deduplicator deduplicator(dedupOptions);
+    DedupReport report = deduplicator.run(options.inputPaths);
+
+    size_t failed = 0;
+    for (const auto& action : report.actions)
+    {
+        if (!action.error.empty())
+        {
+            LOG_ERROR(*logger, action.error);
+            failed++;
+        }
+        else if (options.dryRun)
+        {
+            LOG_INFO(*logger, "[SIMULAÇÃO] " + action.duplicate.string() + " = " +
+                              action.original.string());
+        }
+        else
+        {
+            LOG_INFO(*logger, action.duplicate.string() + " -> " + action.original.string() +
+                              " (" + dedupMethodName(action.method) + ")");
+        }
+    }
+
+    std::cout << "\nDeduplicação\n";
+    std::cout << std::string(40, '=') << "\n\n";
+    std::cout << "Arquivos examinados: " << report.filesScanned << "\n";
+    std::cout << "Mesmo tamanho: " << report.sizeCandidates
+              << ", mesmo início/fim: " << report.hashCandidates << "\n";
+    std::cout << "Grupos idênticos: " << report.groups << "\n";
+    std::cout << "Duplicatas: " << report.duplicates;
+    if (failed > 0)
+    {
+        std::cout << " (" << failed << " com erro)";
+    }
+    std::cout << "\n";
+    std::cout << "Já compartilhados: " << report.alreadyShared << "\n";
+    std::cout << (options.dryRun ? "Espaço a recuperar: " : "Espaço recuperado: ")
+              << formatBytes(report.reclaimedBytes) << "\n";
+}
+
+void RomTrimmer::runChunkReportMode()
+{
+    ChunkOptions chunkOptions;
+    chunkOptions.averageSize = chunkAverageSize;
+    chunkOptions.threads = threadCount;
+
+    ChunkIndex index(chunkOptions);
+    ChunkReport report = index.analyze(options.inputPaths);
+
+    auto printStats = [this](const ChunkSetStats& stats)
+    {
+        std::ostringstream line;
+        line << std::fixed << std::setprecision(2) << stats.ratio() << "x";
+        std::cout << stats.name << ": " << stats.files << " arquivo(s), "
+                  << formatBytes(stats.bytes) << " -> " << formatBytes(stats.uniqueBytes)
+                  << " (" << line.str() << ", " << stats.uniqueChunks << "/"
+                  << stats.chunks << " chunks)\n";
+    };
+
+    std::cout << "\nChunks (FastCDC)\n";
+    std::cout << std::string(40, '=') << "\n\n";
+
+    // Conjunto de um arquivo só não tem com quem dividir; fica no total
+    size_t shown = 0;
+    for (const auto& set : report.sets)
+    {
+        if (set.files > 1 || options.verbose)
+        {
+            printStats(set);
+            shown++;
+        }
+    }
+    if (shown > 0)
+    {
+        std::cout << "\n";
+    }
+
+    uint64_t withinSets = 0;
+    for (const auto& set : report.sets)
+    {
+        withinSets += set.savedBytes();
+    }
+
+    printStats(report.library);
+    std::cout << "Economia dentro dos conjuntos: " << formatBytes(withinSets) << "\n";
+    std::cout << "Economia na biblioteca: " << formatBytes(report.library.savedBytes()) << "\n";
+    if (report.filesFailed > 0)
+    {
+        std::cout << "Falhas de leitura: " << report.filesFailed << "\n";
+    }
+
+    if (!chunkPackPath.empty())
+    {
+        if (options.dryRun)
+        {
+            LOG_INFO(*logger, "[SIMULAÇÃO] Pack não gravado: " + chunkPackPath.string());
+            return;
+        }
+        try
+        {
+            index.writePack(chunkPackPath, inputRoots);
+            LOG_INFO(*logger, "Pack de chunks gravado: " + chunkPackPath.string());
+        }
+        catch (const std::exception& e)
+        {
+            LOG_ERROR(*logger, e.what());
+        }
+    }
+}
+
+void RomTrimmer::runChunkUnpackMode()
+{
+    fs::path outputDir = options.outputDir.empty() ? fs::path(".") : options.outputDir;
+    if (options.dryRun)
+    {
+        LOG_INFO(*logger, "[SIMULAÇÃO] Pack não remontado: " + chunkUnpackPath.string());
+        return;
+    }
+    try
+    {
+        size_t restored = ChunkIndex::unpack(chunkUnpackPath, outputDir, options.force);
+        LOG_INFO(*logger, std::to_string(restored) + " arquivo(s) remontado(s) em " +
+                          outputDir.string());
+    }
+    catch (const std::exception& e)
+    {
+        LOG_ERROR(*logger, e.what());
+    }
+}
+
+void RomTrimmer::runWatchMode()
+{
+    if (!DirectoryWatcher::isSupported())
+    {
+        LOG_ERROR(*logger, "--watch não é suportado nesta plataforma (requer inotify)");
+        return;
+    }
+
+    DirectoryWatcher::Settings settings;
+    settings.settleTime = std::chrono::milliseconds(watchSettleMs);
+    settings.maxQueued = watchQueueSize;
+    settings.recursive = options.recursive;
+
+    DirectoryWatcher watcher(watchDir, settings, [this](const fs::path& file)
+    {
+        if (file.extension() == ".bak")
+        {
+            return false;
+        }
+        return isSupportedFileExtension(file, customExtensions) ||
+               (processCompressed && isCompressedFile(file));
+    });
+
+    if (!watcher.start())
+    {
+        LOG_ERROR(*logger, "Não foi possível monitorar " + watchDir.string() +
+                           ": " + watcher.lastError());
+        return;
+    }
+
+    stopRequested = 0;
+    auto previousInt = std::signal(SIGINT, onStopSignal);
+    auto previousTerm = std::signal(SIGTERM, onStopSignal);
+
+    LOG_INFO(*logger, "Monitorando " + watchDir.string() + " (Ctrl+C para encerrar)");
+
+    // Estado de cada arquivo após nosso próprio processamento; o trim in-place
+    // pode gerar um evento que não deve voltar para a fila. O eco chega
+    // depois do settle; o que não voltou até handledTtl é esquecido (truncar
+    // pelo caminho, por exemplo, não gera IN_CLOSE_WRITE)
+    struct Handled
+    {
+        fs::file_time_type mtime;
+        std::chrono::steady_clock::time_point when;
+    };
+    std::unordered_map<std::string, Handled> handled;
+    const auto handledTtl = std::max<std::chrono::steady_clock::duration>(
+        std::chrono::seconds(10), std::chrono::milliseconds(watchSettleMs) * 4);
+    auto lastPrune = std::chrono::steady_clock::now();
+    size_t lastOverflows = 0;
+
+    fs::path watchRoot = fs::weakly_canonical(watchDir);
+    auto isInsideWatchDir = [&watchRoot](const fs::path& path)
+    {
+        std::error_code ec;
+        fs::path relative = fs::weakly_canonical(path, ec).lexically_relative(watchRoot);
+        return !ec && !relative.empty() && *relative.begin() != "..";
+    };
+
+    auto remember = [&handled](const fs::path& file)
+    {
+        std::error_code ec;
+        auto mtime = fs::last_write_time(file, ec);
+        if (!ec)
+        {
+            handled[file.string()] = {mtime, std::chrono::steady_clock::now()};
+        }
+    };
+
+    fs::path file;
+    while (!stopRequested)
+    {
+        auto now = std::chrono::steady_clock::now();
+        if (now - lastPrune >= handledTtl)
+        {
+            for (auto it = handled.begin(); it != handled.end();)
+            {
+                it = now - it->second.when >= handledTtl ? handled.erase(it) : std::next(it);
+            }
+            lastPrune = now;
+        }
+
+        for (const auto& warning : watcher.takeWarnings())
+        {
+            LOG_WARNING(*logger, "Fora do monitoramento: " + warning);
+        }
+
+        if (!watcher.next(file, std::chrono::milliseconds(250)))
+        {
+            // Thread do inotify morreu (poll falhou): não há mais o que esperar
+            if (!watcher.isRunning())
+            {
+                LOG_ERROR(*logger, "Monitoramento interrompido: " + watcher.lastError());
+                break;
+            }
+            continue;
+        }
+
+        if (watcher.overflowCount() != lastOverflows)
+        {
+            lastOverflows = watcher.overflowCount();
+            LOG_WARNING(*logger, "Fila do inotify estourou; diretório reescaneado");
+        }
+
+        // Cada escrita nossa gera um evento só: visto de novo, sai do mapa
+        std::error_code ec;
+        auto mtime = fs::last_write_time(file, ec);
+        auto known = handled.find(file.string());
+        if (known != handled.end())
+        {
+            bool ownWrite = !ec && known->second.mtime == mtime;
+            handled.erase(known);
+            if (ownWrite)
+            {
+                LOG_DEBUG(*logger, "Ignorando arquivo já processado: " + file.string());
+                continue;
+            }
+        }
+
+        std::vector<fs::path> targets;
+        if (processCompressed && isCompressedFile(file))
+        {
+            if (!processCompressedArchive(file, targets))
+            {
+                LOG_ERROR(*logger, "Falha ao processar arquivo compactado: " + file.string());
+                filesFailed++;
+                continue;
+            }
+        }
+        else
+        {
+            targets.push_back(file);
+        }
+
+        for (const auto& target : targets)
+        {
+            if (processFile(target))
+            {
+                filesProcessed++;
+            }
+            else
+            {
+                filesFailed++;
+            }
+        }
+
+        // Só o que foi reescrito volta como evento; a saída fora do
+        // diretório observado nunca volta e não entra no mapa
+        auto after = fs::last_write_time(file, ec);
+        if (!ec && after != mtime)
+        {
+            remember(file);
+        }
+        if (!options.outputDir.empty() && isInsideWatchDir(determineOutputPath(file)))
+        {
+            remember(determineOutputPath(file));
+        }
+    }
+
+    std::signal(SIGINT, previousInt);
+    std::signal(SIGTERM, previousTerm);
+    watcher.stop();
+
+    LOG_INFO(*logger, "Monitoramento encerrado");
+}
+
 bool RomTrimmer::processFile(const fs::path& filePath)
 {
     FileStats stats;
     stats.path = filePath;
     stats.startTime = std::chrono::steady_clock::now();
 
+    // Fecha a etapa atual e guarda sua duração em `slot`
+    auto stageMark = stats.startTime;
+    auto lap = [&stageMark](double& slot)
+    {
+        auto now = std::chrono::steady_clock::now();
+        slot = std::chrono::duration<double, std::milli>(now - stageMark).count();
+        stageMark = now;
+    };
+
     try
     {
         // Log inicial
-        logger->log(TR("PROCESSING") + filePath.string(), LogLevel::INFO);
+        LOG_INFO(*logger, std::string(TR("PROCESSING")) + filePath.string());
+
+        // 0. Pré-classificar pelo header: nada de mapear o que não é ROM
+        RomDetector::Probe probe = romDetector->probeFile(filePath);
+        if (!probe.worthReading)
+        {
+            std::error_code ec;
+            stats.originalSize = fs::file_size(filePath, ec);
+            stats.trimmedSize = stats.originalSize;
+            stats.trimPoint = stats.originalSize;
+            lap(stats.readMs);
+
+            // Vazio também não vale a leitura, mas é erro, não tipo desconhecido
+            if (!ec && stats.originalSize == 0)
+            {
+                throw std::runtime_error(std::string(TR("EMPTY_FILE")));
+            }
+
+            LOG_WARNING(*logger, TR("UNKNOWN_ROM"));
+            stats.error = TR("UNKNOWN_ROM");
+            stats.unknownType = true;
+            recordFileStats(stats);
+            return false;
+        }
 
         // 1. Ler arquivo
-        std::string data = readFile(filePath);
+        MappedFile input;
+        openRomFile(filePath, input);
+        std::string_view data = input.view();
         stats.originalSize = data.size();
+        stats.trimmedSize = data.size();
+        stats.trimPoint = data.size();
+        lap(stats.readMs);
 
         if (data.empty())
         {
-            throw std::runtime_error(TR("EMPTY_FILE"));
+            throw std::runtime_error(std::string(TR("EMPTY_FILE")));
         }
 
         // 2. Detectar tipo de ROM
         RomType romType = romDetector->detect(data);
+        stats.type = romType;
         stats.romType = romTypeToString(romType);
+        lap(stats.detectMs);
 
         if (romType == RomType::UNKNOWN)
         {
-            logger->log(TR("UNKNOWN_ROM"), LogLevel::WARNING);
+            LOG_WARNING(*logger, TR("UNKNOWN_ROM"));
             stats.error = TR("UNKNOWN_ROM");
+            stats.unknownType = true;
             recordFileStats(stats);
             return false;
         }
 
-        // 3. Detectar padding
-        uint8_t paddingByte = determinePaddingByte(data, romType);
-        logger->log(std::string(TR("AUTO_PADDING_DETECTED")) +
-                    (paddingByte == 0xFF ? "FF" : "00"),
-                    LogLevel::DEBUG);
-
-        // 4. Analisar padding
-        PaddingAnalysis analysis = paddingAnalyzer->analyze(data, paddingByte);
+        // Header de copiadora (SNES .smc): daqui em diante só o payload,
+        // sem copiar nada; trimPoint volta para offsets do arquivo
+        size_t headerSize = 0;
+        if (romType == RomType::SNES)
+        {
+            headerSize = parseSnesLayout(data, data.size()).copierHeader;
+        }
+        std::string_view payload = data.substr(headerSize);
+        bool stripHeader = options.stripCopierHeader && headerSize > 0;
+        stats.headerSize = headerSize;
+
+        // 3-4. Detectar e analisar padding (em auto, numa varredura só)
+        PaddingAnalysis analysis = analyzePadding(payload, romType);
+        stats.paddingByte = analysis.paddingByte;
+        stats.confidence = analysis.confidence;
+        if (options.paddingByte == 0)
+        {
+            char hex[3];
+            std::snprintf(hex, sizeof(hex), "%02X", analysis.paddingByte);
+            LOG_DEBUG(*logger, std::string(TR("AUTO_PADDING_DETECTED")) + hex);
+        }
+        lap(stats.paddingMs);
 
-        if (!analysis.hasPadding)
+        // Sem padding ainda vale reescrever quando o header deve sair
+        if (!analysis.hasPadding && !stripHeader)
         {
-            logger->log(TR("NO_PADDING"), LogLevel::INFO);
+            LOG_INFO(*logger, TR("NO_PADDING"));
             stats.trimmed = false;
             stats.trimmedSize = stats.originalSize;
             recordFileStats(stats);
@@ -661,22 +1217,34 @@ bool RomTrimmer::processFile(const fs::path& filePath)
         }
 
         // 5. Calcular ponto de corte
-        size_t trimPoint = analysis.trimPoint;
-        stats.trimmedSize = trimPoint;
-        stats.savedRatio = 1.0 - (double)trimPoint / stats.originalSize;
-
-        // 6. Validar segurança
-        ValidationResult validation = safetyValidator->validate(
-                                          data, trimPoint, romType, options);
-
-        if (!validation.isValid)
+        size_t payloadTrim = analysis.hasPadding ? analysis.trimPoint : payload.size();
+        size_t trimPoint = headerSize + payloadTrim;
+        stats.trimPoint = trimPoint;
+        stats.trimmedSize = trimPoint - (stripHeader ? headerSize : 0);
+        stats.savedRatio = 1.0 - (double)stats.trimmedSize / stats.originalSize;
+
+        // 6. Validar segurança (nada a validar se só o header sai)
+        if (analysis.hasPadding)
         {
-            handleValidationFailure(validation, stats);
-            return !options.force; // Retorna false apenas se não for forçar
+            ValidationResult validation = safetyValidator->validate(
+                                              payload, payloadTrim, romType, options);
+            if (!validation.isValid)
+            {
+                handleValidationFailure(validation, stats);
+                // Ainda um registro por arquivo (NDJSON), mesmo sem gravar
+                lap(stats.validateMs);
+                stats.unsafeSkipped = true;
+                stats.trimmedSize = stats.originalSize;
+                stats.savedRatio = 0.0;
+                recordFileStats(stats);
+                return !options.force; // Retorna false apenas se não for forçar
+            }
         }
+        lap(stats.validateMs);
 
         // 7. Executar ação baseada no modo
-        return executeFileAction(filePath, data, trimPoint, stats);
+        stats.actionStart = std::chrono::steady_clock::now();
+        return executeFileAction(filePath, input, trimPoint, stats);
 
     }
     catch (const std::exception& e)
@@ -686,13 +1254,13 @@ bool RomTrimmer::processFile(const fs::path& filePath)
     }
 }
 
-uint8_t RomTrimmer::determinePaddingByte(const std::string& data, RomType romType)
+PaddingAnalysis RomTrimmer::analyzePadding(std::string_view data, RomType romType)
 {
     if (options.paddingByte != 0)
     {
-        return options.paddingByte;
+        return paddingAnalyzer->analyze(data, options.paddingByte, romType);
     }
-    return paddingAnalyzer->autoDetectPadding(data, romType);
+    return paddingAnalyzer->analyzeAuto(data, romType);
 }
 
 void RomTrimmer::handleValidationFailure(const ValidationResult& validation,
@@ -700,63 +1268,65 @@ void RomTrimmer::handleValidationFailure(const ValidationResult& validation,
 {
     if (!options.force)
     {
-        logger->log(TR("UNSAFE_TRIM") + validation.message, LogLevel::ERROR);
-        stats.error = validation.message;
-        recordFileStats(stats);
-        throw std::runtime_error("Validação falhou");
+        LOG_ERROR(*logger, std::string(TR("UNSAFE_TRIM")) + validation.message);
+        throw std::runtime_error(validation.message);
     }
     else
     {
-        logger->log(TR("WARNING_FORCING_TRIM") + validation.message,
-                    LogLevel::WARNING);
+        LOG_WARNING(*logger, std::string(TR("WARNING_FORCING_TRIM")) + validation.message);
         stats.warnings.push_back("Forçado: " + validation.message);
     }
 }
 
 bool RomTrimmer::executeFileAction(const fs::path& filePath,
-                                   const std::string& data,
+                                   MappedFile& input,
                                    size_t trimPoint,
                                    FileStats& stats)
 {
     if (options.analyzeOnly)
     {
-        return handleAnalysisMode(data, trimPoint, stats);
+        return handleAnalysisMode(input.view(), stats);
     }
     else if (options.dryRun)
     {
-        return handleDryRunMode(data, trimPoint, stats);
+        return handleDryRunMode(input.view(), stats);
     }
     else
     {
-        return handleActualTrim(filePath, data, trimPoint, stats);
+        return handleActualTrim(filePath, input, trimPoint, stats);
     }
 }
 
-bool RomTrimmer::handleAnalysisMode(const std::string& data,
-                                    size_t trimPoint,
-                                    FileStats& stats)
+bool RomTrimmer::handleAnalysisMode(std::string_view data, FileStats& stats)
 {
-    size_t savedBytes = data.size() - trimPoint;
+    size_t savedBytes = data.size() - stats.trimmedSize;
     double savedPercent = stats.savedRatio * 100;
 
-    logger->log(TR("ANALYSIS") + formatBytes(savedBytes) +
-                TR("CAN_BE_REMOVED") +
-                std::to_string(savedPercent) + "%)",
-                LogLevel::INFO);
+    LOG_INFO(*logger, std::string(TR("ANALYSIS")) + formatBytes(savedBytes) +
+                      std::string(TR("CAN_BE_REMOVED")) +
+                      std::to_string(savedPercent) + "%)");
 
     stats.trimmed = false;
     recordFileStats(stats);
     return true;
 }
 
-bool RomTrimmer::handleDryRunMode(const std::string& data,
-                                  size_t trimPoint,
-                                  FileStats& stats)
+bool RomTrimmer::handleDryRunMode(std::string_view data, FileStats& stats)
 {
-    size_t savedBytes = data.size() - trimPoint;
+    size_t savedBytes = data.size() - stats.trimmedSize;
+
+    if (options.sparse &&
+        (stats.paddingByte != 0x00 || paddingAnalyzer->findTrueEndOfData(data, 0x00) > stats.trimPoint))
+    {
+        LOG_INFO(*logger, "[SIMULAÇÃO] Trecho após o corte não é todo 0x00: nada a desalocar com --sparse");
+        stats.notPunchable = true;
+        stats.trimmedSize = stats.originalSize;
+        stats.trimmed = false;
+        recordFileStats(stats);
+        return true;
+    }
 
-    logger->log(TR("SIMULATION_REMOVE") + formatBytes(savedBytes),
-                LogLevel::INFO);
+    LOG_INFO(*logger, std::string(TR("SIMULATION_REMOVE")) + formatBytes(savedBytes));
 
     stats.trimmed = false;
     recordFileStats(stats);
@@ -764,50 +1334,106 @@ bool RomTrimmer::handleDryRunMode(const std::string& data,
 }
 
 bool RomTrimmer::handleActualTrim(const fs::path& filePath,
-                                 const std::string& data,
+                                 MappedFile& input,
                                  size_t trimPoint,
                                  FileStats& stats) {
-    // Criar backup se necessário
-    if (options.backup) {
+    size_t originalSize = input.size();
+    size_t savedBytes = originalSize - stats.trimmedSize;
+
+    // Buraco só lê como zeros: só vale se tudo depois do corte já for 0x00
+    // (o trimPoint do NDS vem do header, não de uma varredura da cauda)
+    if (options.sparse &&
+        (stats.paddingByte != 0x00 || paddingAnalyzer->findTrueEndOfData(input.view(), 0x00) > trimPoint)) {
+        LOG_WARNING(*logger, "Trecho após o corte não é todo 0x00, não pode virar buraco: " +
+                             filePath.string());
+        stats.warnings.push_back("sparse: trecho após o corte não é todo 0x00");
+        stats.notPunchable = true;
+        stats.trimmedSize = originalSize;
+        stats.savedRatio = 0.0;
+        recordFileStats(stats);
+        return true;
+    }
+
+    // Criar backup se necessário (o --sparse não altera nenhum byte)
+    if (options.backup && !options.sparse) {
         createBackup(filePath);
     }
 
     // Escrever arquivo trimado
     fs::path trimmedPath = determineOutputPath(filePath);
 
-    if (!writeTrimmedFile(trimmedPath, data, trimPoint)) {
-        return false;
+    if (options.sparse) {
+        uint64_t freedBytes = 0;
+        if (!punchPaddingHole(trimmedPath, input, trimPoint, freedBytes)) {
+            stats.error = "Arquivo de saída já existe: " + trimmedPath.string();
+            recordFileStats(stats);
+            return false;
+        }
+        // Nada desalocado (ex.: cauda já era buraco numa execução anterior):
+        // igual ao caso sem padding, não conta como trim
+        if (freedBytes == 0) {
+            LOG_INFO(*logger, "Nenhum bloco desalocado (padding já esparso?): " +
+                              trimmedPath.string());
+            stats.trimmed = false;
+            stats.trimmedSize = originalSize;
+            stats.savedRatio = 0.0;
+            recordFileStats(stats);
+            return true;
+        }
+        // Economia real em disco (blocos inteiros); o tamanho lógico não muda,
+        // então trimmedSize passa a ser o que o arquivo ocupa a menos
+        savedBytes = static_cast<size_t>(freedBytes);
+        stats.trimmedSize = originalSize - savedBytes;
+        stats.savedRatio = static_cast<double>(savedBytes) / originalSize;
+    } else {
+        // Mesmo caminho de escrita da API/serviço; o backup já foi feito acima
+        TrimOptions writeOptions = options;
+        writeOptions.backup = false;
+
+        TrimReport report;
+        report.trimPoint = trimPoint;
+        report.headerSize = stats.headerSize;
+        report.hasPadding = true;
+        report = TrimEngine(writeOptions).commit(input, report, trimmedPath);
+
+        if (report.failure == TrimFailure::OUTPUT_EXISTS) {
+            LOG_WARNING(*logger, report.error);
+            stats.error = report.error;
+            recordFileStats(stats);
+            return false;
+        }
+        if (!report.ok()) {
+            throw std::runtime_error(std::string(TR("ERROR_WRITING")) + report.error);
+        }
     }
 
-    size_t savedBytes = data.size() - trimPoint;
     double savedPercent = stats.savedRatio * 100;
 
     // ==================== REZIP ====================
     if (rezipAfterTrim && !extractCompressed) {
-        logger->log("Iniciando recompactação...", LogLevel::INFO);
+        LOG_INFO(*logger, "Iniciando recompactação...");
 
         if (rezipFile(trimmedPath)) {
-            logger->log("Arquivo recomprimido com sucesso", LogLevel::INFO);
+            LOG_INFO(*logger, "Arquivo recomprimido com sucesso");
             stats.rezipped = true;
 
             // Remover arquivo original após rezip se configurado
             if (!keepOriginalAfterRezip) {
                 try {
                     fs::remove(trimmedPath);
-                    logger->log("Arquivo original removido após rezip", LogLevel::DEBUG);
+                    LOG_DEBUG(*logger, "Arquivo original removido após rezip");
                 } catch (const std::exception& e) {
-                    logger->log("Não foi possível remover arquivo original: " +
-                               std::string(e.what()), LogLevel::WARNING);
+                    LOG_WARNING(*logger, "Não foi possível remover arquivo original: " +
+                                        std::string(e.what()));
                 }
             }
         } else {
-            logger->log("Falha na recompactação", LogLevel::ERROR);
+            LOG_ERROR(*logger, "Falha na recompactação");
         }
     }
 
-    logger->log(TR("TRIM_SUCCESS") + formatBytes(savedBytes) +
-               " (" + std::to_string(savedPercent) + "%)",
-               LogLevel::INFO);
+    LOG_INFO(*logger, std::string(TR("TRIM_SUCCESS")) + formatBytes(savedBytes) +
+                     " (" + std::to_string(savedPercent) + "%)");
 
     stats.trimmed = true;
     stats.trimmedPath = trimmedPath;
@@ -822,104 +1448,68 @@ void RomTrimmer::handleProcessingError(const fs::path& filePath,
                                        const std::string& error,
                                        FileStats& stats)
 {
-    logger->log(TR("ERROR_PROCESSING") + filePath.string() + ": " + error,
-                LogLevel::ERROR);
+    LOG_ERROR(*logger, std::string(TR("ERROR_PROCESSING")) + filePath.string() + ": " + error);
     stats.error = error;
-    stats.endTime = std::chrono::steady_clock::now();
-    stats.duration = std::chrono::duration_cast<std::chrono::milliseconds>(
-                         stats.endTime - stats.startTime);
-
-    std::lock_guard<std::mutex> lock(statsMutex);
-    fileStats.push_back(stats);
+    recordFileStats(stats);
 }
 
 // ==================== OPERAÇÕES DE ARQUIVO ====================
-std::string RomTrimmer::readFile(const fs::path& filePath)
+void RomTrimmer::openRomFile(const fs::path& filePath, MappedFile& input)
 {
-    std::ifstream file(filePath, std::ios::binary | std::ios::ate);
-    if (!file.is_open())
+    try
     {
-        throw std::runtime_error(TR("CANNOT_OPEN_FILE") + ": " + filePath.string());
+        // mmap: as etapas só tocam as páginas que realmente leem
+        input.open(filePath);
     }
-
-    // Obter tamanho
-    std::streamsize size = file.tellg();
-    if (size <= 0)
+    catch (const std::exception&)
     {
-        throw std::runtime_error(TR("EMPTY_FILE"));
+        throw std::runtime_error(std::string(TR("CANNOT_OPEN_FILE")) + ": " + filePath.string());
     }
 
-    // Verificar tamanho máximo (prevenção contra arquivos muito grandes)
-    constexpr std::streamsize MAX_FILE_SIZE = 1024 * 1024 * 1024; // 1GB
-    if (size > MAX_FILE_SIZE)
+    if (input.size() == 0)
     {
-        throw std::runtime_error("Arquivo muito grande (" +
-                                 std::to_string(size) + " bytes)");
+        throw std::runtime_error(std::string(TR("EMPTY_FILE")));
     }
 
-    // Ler conteúdo
-    file.seekg(0, std::ios::beg);
-    std::string buffer(size, '\0');
-
-    if (!file.read(&buffer[0], size))
+    // Verificar tamanho máximo (prevenção contra arquivos muito grandes)
+    constexpr size_t MAX_FILE_SIZE = 1024 * 1024 * 1024; // 1GB
+    if (input.size() > MAX_FILE_SIZE)
     {
-        throw std::runtime_error(TR("ERROR_READING_FILE") + ": " + filePath.string());
+        throw std::runtime_error("Arquivo muito grande (" +
+                                 std::to_string(input.size()) + " bytes)");
     }
-
-    return buffer;
 }
 
-bool RomTrimmer::writeTrimmedFile(const fs::path& filePath,
-                                  const std::string& data,
-                                  size_t trimPoint)
+bool RomTrimmer::punchPaddingHole(const fs::path& filePath,
+                                  MappedFile& input,
+                                  size_t trimPoint,
+                                  uint64_t& freedBytes)
 {
-    try
-    {
-        // Determinar caminho de saída
-        fs::path outputPath = determineOutputPath(filePath);
+    fs::path outputPath = determineOutputPath(filePath);
+
+    std::error_code ec;
+    bool inPlace = outputPath == input.path() ||
+                   fs::equivalent(outputPath, input.path(), ec);
 
-        // Verificar se o arquivo de saída já existe
+    // Com --output o arquivo vai inteiro (o kernel copia) e o buraco é na cópia
+    if (!inPlace)
+    {
         if (fs::exists(outputPath) && !options.force)
         {
-            logger->log("Arquivo de saída já existe: " + outputPath.string(),
-                        LogLevel::WARNING);
+            LOG_WARNING(*logger, "Arquivo de saída já existe: " + outputPath.string());
             return false;
         }
-
-        // Criar diretório pai se não existir
-        fs::create_directories(outputPath.parent_path());
-
-        // Escrever arquivo
-        std::ofstream outFile(outputPath, std::ios::binary);
-        if (!outFile)
-        {
-            throw std::runtime_error(TR("CANNOT_CREATE_OUTPUT") + ": " +
-                                     outputPath.string());
-        }
-
-        outFile.write(data.data(), trimPoint);
-
-        // Verificar se a escrita foi bem-sucedida
-        if (!outFile.good())
+        if (outputPath.has_parent_path())
         {
-            throw std::runtime_error("Falha na escrita do arquivo");
+            fs::create_directories(outputPath.parent_path());
         }
-
-        outFile.close();
-
-        // Verificar tamanho do arquivo escrito
-        if (fs::file_size(outputPath) != trimPoint)
-        {
-            throw std::runtime_error("Tamanho do arquivo escrito incorreto");
-        }
-
-        return true;
-
-    }
-    catch (const std::exception& e)
-    {
-        throw std::runtime_error(std::string(TR("ERROR_WRITING")) + e.what());
+        copyFileRegion(input.path(), 0, input.size(), outputPath);
     }
+
+    // O buraco lê como os mesmos zeros: o mapeamento pode continuar aberto
+    freedBytes = punchFileHole(outputPath, trimPoint, input.size() - trimPoint);
+    LOG_DEBUG(*logger, "Padding desalocado: " + outputPath.string());
+    return true;
 }
 
 fs::path RomTrimmer::determineOutputPath(const fs::path& inputPath)
@@ -940,15 +1530,13 @@ void RomTrimmer::createBackup(const fs::path& filePath) const
     {
         if (fs::exists(backupPath))
         {
-            logger->log(TR("BACKUP_EXISTS_OVERWRITING") + backupPath.string(),
-                        LogLevel::WARNING);
+            LOG_WARNING(*logger, std::string(TR("BACKUP_EXISTS_OVERWRITING")) + backupPath.string());
         }
 
         fs::copy_file(filePath, backupPath,
                       fs::copy_options::overwrite_existing);
 
-        logger->log(TR("BACKUP_CREATED") + backupPath.string(),
-                    LogLevel::DEBUG);
+        LOG_DEBUG(*logger, std::string(TR("BACKUP_CREATED")) + backupPath.string());
 
     }
     catch (const std::exception& e)
@@ -992,11 +1580,6 @@ void RomTrimmer::printSummary() const
         std::cout << "  Formato: " << rezipFormat << "\n";
         std::cout << "  Nível de compressão: " << rezipLevel << "\n";
 
-        int filesRezipped = 0;
-        for (const auto& stats : fileStats) {
-            if (stats.rezipped) filesRezipped++;
-        }
-
         std::cout << "  Arquivos recomprimidos: " << filesRezipped << "\n";
     }
 
@@ -1098,6 +1681,14 @@ std::string RomTrimmer::romTypeToString(RomType type) const
         return "GB";
     case RomType::GBC:
         return "GBC";
+    case RomType::NES:
+        return "NES";
+    case RomType::SNES:
+        return "SNES";
+    case RomType::N64:
+        return "N64";
+    case RomType::MEGADRIVE:
+        return "Mega Drive";
     default:
         return "Desconhecido";
     }
@@ -1111,7 +1702,7 @@ void RomTrimmer::handleCriticalError(const std::string& error)
     // Tentar registrar no log
     try
     {
-        logger->log("Erro crítico: " + error, LogLevel::ERROR);
+        LOG_ERROR(*logger, "Erro crítico: " + error);
     }
     catch (...)
     {
@@ -1137,7 +1728,7 @@ void RomTrimmer::handleCriticalError(const std::string& error)
 void RomTrimmer::startProcessing()
 {
     processingStartTime = std::chrono::steady_clock::now();
-    logger->log("Iniciando processamento...", LogLevel::INFO);
+    LOG_INFO(*logger, "Iniciando processamento...");
 }
 
 void RomTrimmer::cleanup()
@@ -1149,8 +1740,8 @@ void RomTrimmer::cleanup()
     }
     catch (const std::exception& e)
     {
-        logger->log("Não foi possível salvar configurações: " +
-                    std::string(e.what()), LogLevel::WARNING);
+        LOG_WARNING(*logger, "Não foi possível salvar configurações: " +
+                             std::string(e.what()));
     }
 
     // Limpar diretório temporário de extração
@@ -1161,19 +1752,19 @@ void RomTrimmer::cleanup()
             if (!extractCompressed)   // Só limpar se não for apenas extração
             {
                 fs::remove_all(tempExtractDir);
-                logger->log("Diretório temporário limpo: " + tempExtractDir.string(),
-                            LogLevel::DEBUG);
+                LOG_DEBUG(*logger, "Diretório temporário limpo: " + tempExtractDir.string());
             }
         }
         catch (const std::exception& e)
         {
-            logger->log("Não foi possível limpar diretório temporário: " +
-                        std::string(e.what()), LogLevel::WARNING);
+            LOG_WARNING(*logger, "Não foi possível limpar diretório temporário: " +
+                                 std::string(e.what()));
         }
     }
 
     // Limpar estatísticas
     fileStats.clear();
+    filesRezipped = 0;
     filesProcessed = 0;
     filesTrimmed = 0;
     filesFailed = 0;
@@ -1184,9 +1775,99 @@ void RomTrimmer::recordFileStats(FileStats& stats)
     stats.endTime = std::chrono::steady_clock::now();
     stats.duration = std::chrono::duration_cast<std::chrono::milliseconds>(
                          stats.endTime - stats.startTime);
+    if (stats.actionStart != std::chrono::steady_clock::time_point{})
+    {
+        stats.writeMs = std::chrono::duration<double, std::milli>(
+                            stats.endTime - stats.actionStart).count();
+    }
+
+    if (stats.rezipped)
+    {
+        filesRezipped++;
+    }
+
+    // --watch roda indefinidamente: ali só os totais acumulam
+    if (watchDir.empty())
+    {
+        std::lock_guard<std::mutex> lock(statsMutex);
+        fileStats.push_back(stats);
+    }
+
+    if (resultWriter)
+    {
+        emitFileRecord(stats);
+    }
+}
+
+void RomTrimmer::emitFileRecord(const FileStats& stats)
+{
+    const char* status = "no_padding";
+    if (!stats.error.empty())
+        status = stats.unknownType ? "unknown" : "error";
+    else if (stats.unsafeSkipped)
+        status = "unsafe";
+    else if (stats.notPunchable)
+        status = "not_punchable";
+    else if (stats.trimmed)
+        status = "trimmed";
+    else if (stats.trimmedSize < stats.originalSize)
+        status = options.analyzeOnly ? "analyzed" : "dry_run";
+
+    JsonWriter json;
+    json.field("path", stats.path.string())
+        .field("status", status)
+        .field("rom_type", romTypeName(stats.type))
+        .field("padding_byte", static_cast<unsigned>(stats.paddingByte))
+        .field("original_size", stats.originalSize)
+        .field("trim_point", stats.trimPoint)
+        .field("saved_bytes", stats.originalSize - stats.trimmedSize)
+        .field("confidence", stats.confidence)
+        .field("read_ms", stats.readMs)
+        .field("detect_ms", stats.detectMs)
+        .field("padding_ms", stats.paddingMs)
+        .field("validate_ms", stats.validateMs)
+        .field("write_ms", stats.writeMs)
+        .field("total_ms", std::chrono::duration<double, std::milli>(
+                               stats.endTime - stats.startTime).count());
+
+    if (stats.headerSize > 0)
+    {
+        json.field("copier_header", stats.headerSize);
+    }
+    if (stats.trimmed)
+    {
+        json.field("output", stats.trimmedPath.string());
+    }
+    if (stats.rezipped)
+    {
+        json.field("rezipped", true);
+    }
+    if (!stats.warnings.empty())
+    {
+        json.stringArray("warnings", stats.warnings);
+    }
+    if (!stats.error.empty())
+    {
+        json.field("error", stats.error);
+    }
 
-    std::lock_guard<std::mutex> lock(statsMutex);
-    fileStats.push_back(stats);
+    resultWriter->write(json.finish());
+}
+
+void RomTrimmer::emitSummaryRecord()
+{
+    auto elapsed = std::chrono::duration<double, std::milli>(
+                       std::chrono::steady_clock::now() - processingStartTime);
+
+    resultWriter->write(JsonWriter()
+                            .field("summary", true)
+                            .field("processed", filesProcessed.load())
+                            .field("trimmed", filesTrimmed.load())
+                            .field("failed", filesFailed.load())
+                            .field("saved_bytes", totalSaved.load())
+                            .field("elapsed_ms", elapsed.count())
+                            .finish());
+    resultWriter->flush();
 }
 
 // ==================== HELP ====================
@@ -1235,12 +1916,12 @@ void RomTrimmer::processCustomExtensions(const std::string& extensions)
         customExtensions.insert(ext);
     }
 
-    if (options.verbose && !customExtensions.empty())
+    if (logger->isEnabled(LogLevel::DEBUG) && !customExtensions.empty())
     {
-        logger->log("Extensões personalizadas definidas:", LogLevel::DEBUG);
+        LOG_DEBUG(*logger, "Extensões personalizadas definidas:");
         for (const auto& ext : customExtensions)
         {
-            logger->log("  - " + ext, LogLevel::DEBUG);
+            LOG_DEBUG(*logger, "  - " + ext);
         }
     }
 }
@@ -1280,8 +1961,7 @@ bool RomTrimmer::processCompressedArchive(const fs::path& archivePath,
         }
         fs::create_directories(extractPath);
 
-        logger->log("Extraindo arquivo compactado: " + archivePath.string(),
-                    LogLevel::INFO);
+        LOG_INFO(*logger, "Extraindo arquivo compactado: " + archivePath.string());
 
         // Extrair arquivo
         std::string extension = archivePath.extension().string();
@@ -1303,25 +1983,22 @@ bool RomTrimmer::processCompressedArchive(const fs::path& archivePath,
         }
         else
         {
-            logger->log("Formato de compactação não suportado: " + extension,
-                        LogLevel::ERROR);
+            LOG_ERROR(*logger, "Formato de compactação não suportado: " + extension);
             return false;
         }
 
         if (!extractionSuccess)
         {
-            logger->log("Falha ao extrair arquivo: " + archivePath.string(),
-                        LogLevel::ERROR);
+            LOG_ERROR(*logger, "Falha ao extrair arquivo: " + archivePath.string());
             return false;
         }
 
-        logger->log("Extração concluída: " + archivePath.string(), LogLevel::INFO);
+        LOG_INFO(*logger, "Extração concluída: " + archivePath.string());
 
         // Se for apenas extração, não processar os arquivos extraídos
         if (extractCompressed)
         {
-            logger->log("Arquivos extraídos para: " + extractPath.string(),
-                        LogLevel::INFO);
+            LOG_INFO(*logger, "Arquivos extraídos para: " + extractPath.string());
             return true;
         }
 
@@ -1333,8 +2010,7 @@ bool RomTrimmer::processCompressedArchive(const fs::path& archivePath,
                 if (isSupportedFileExtension(entry.path(), customExtensions))
                 {
                     allFiles.push_back(entry.path());
-                    logger->log("Adicionando arquivo extraído: " + entry.path().string(),
-                                LogLevel::DEBUG);
+                    LOG_DEBUG(*logger, "Adicionando arquivo extraído: " + entry.path().string());
                 }
             }
         }
@@ -1344,8 +2020,8 @@ bool RomTrimmer::processCompressedArchive(const fs::path& archivePath,
     }
     catch (const std::exception& e)
     {
-        logger->log("Erro ao processar arquivo compactado " + archivePath.string() +
-                    ": " + e.what(), LogLevel::ERROR);
+        LOG_ERROR(*logger, "Erro ao processar arquivo compactado " + archivePath.string() +
+                           ": " + e.what());
         return false;
     }
 }
@@ -1415,8 +2091,7 @@ bool extractWithWindowsAPI(const fs::path& archivePath,
 bool RomTrimmer::rezipFile(const fs::path& trimmedPath) {
     try {
         if (!fs::exists(trimmedPath) || !fs::is_regular_file(trimmedPath)) {
-            logger->log("Arquivo trimado não encontrado: " + trimmedPath.string(),
-                       LogLevel::ERROR);
+            LOG_ERROR(*logger, "Arquivo trimado não encontrado: " + trimmedPath.string());
             return false;
         }
 
@@ -1429,8 +2104,7 @@ if (rezipFormat == "tar.gz") {
 }
 
 
-        logger->log("Criando arquivo compactado: " + archivePath.string(),
-                   LogLevel::INFO);
+        LOG_INFO(*logger, "Criando arquivo compactado: " + archivePath.string());
 
         bool success = false;
 
@@ -1447,16 +2121,14 @@ if (rezipFormat == "tar.gz") {
             size_t archiveSize = fs::file_size(archivePath);
             double compressionRatio = 100.0 * (1.0 - (double)archiveSize / originalSize);
 
-            logger->log("Compactação concluída: " + formatBytes(archiveSize) +
-                       " (redução de " + std::to_string((int)compressionRatio) + "%)",
-                       LogLevel::INFO);
+            LOG_INFO(*logger, "Compactação concluída: " + formatBytes(archiveSize) +
+                             " (redução de " + std::to_string((int)compressionRatio) + "%)");
         }
 
         return success;
 
     } catch (const std::exception& e) {
-        logger->log("Erro ao recomprimir arquivo: " + std::string(e.what()),
-                   LogLevel::ERROR);
+        LOG_ERROR(*logger, "Erro ao recomprimir arquivo: " + std::string(e.what()));
         return false;
     }
 }
@@ -1473,7 +2145,7 @@ bool RomTrimmer::createZipArchive(const fs::path& filePath, const fs::path& zipP
                          zipPath.string() + "\" \"" + filePath.string() + "\"";
 #endif
 
-    logger->log("Executando: " + command, LogLevel::DEBUG);
+    LOG_DEBUG(*logger, "Executando: " + command);
 
     int result = system(command.c_str());
     return result == 0;
@@ -1484,7 +2156,7 @@ bool RomTrimmer::create7zArchive(const fs::path& filePath, const fs::path& archi
                          " \"" + archivePath.string() + "\" \"" +
                          filePath.string() + "\"";
 
-    logger->log("Executando: " + command, LogLevel::DEBUG);
+    LOG_DEBUG(*logger, "Executando: " + command);
 
     int result = system(command.c_str());
     return result == 0;
@@ -1494,7 +2166,7 @@ bool RomTrimmer::createTarGzArchive(const fs::path& filePath, const fs::path& ar
     std::string command = "tar -czf \"" + archivePath.string() + "\" \"" +
                          filePath.string() + "\"";
 
-    logger->log("Executando: " + command, LogLevel::DEBUG);
+    LOG_DEBUG(*logger, "Executando: " + command);
 
     int result = system(command.c_str());
     return result == 0;
@@ -2,6 +2,8 @@
 #include "ValidationResult.hpp"
 #include "TrimOptions.hpp"
 #include "Localization.hpp"
+#include "NdsHeader.hpp"
+#include "SnesHeader.hpp"
 
 #include <algorithm>
 #include <cmath>
@@ -15,21 +17,22 @@ size_t SafetyValidator::getMinSizeForRomType(RomType type) {
     switch (type) {
         case RomType::GBA: return MIN_GBA_SIZE;
         case RomType::NDS: return MIN_NDS_SIZE;
-        case RomType::GB:  return MIN_GB_SIZE;
+        case RomType::GB:
+        case RomType::GBC: return MIN_GB_SIZE;
         default:           return 1024;
     }
 }
 
 // ==================== GBA ====================
 
-bool SafetyValidator::validateGba(const std::string& data, size_t trimPoint) {
+bool SafetyValidator::validateGba(std::string_view data, size_t trimPoint) {
     if (trimPoint < 0xA0) return false;
     if (trimPoint > 32 * 1024 * 1024) return false;
     return validateGbaInternalRomSize(data, trimPoint);
 }
 
 bool SafetyValidator::validateGbaInternalRomSize(
-    const std::string& data, size_t trimPoint)
+    std::string_view data, size_t trimPoint)
 {
     if (trimPoint % 0x1000 == 0) return true;
 
@@ -46,14 +49,20 @@ bool SafetyValidator::validateGbaInternalRomSize(
 
 // ==================== NDS ====================
 
-bool SafetyValidator::validateNds(const std::string& data, size_t trimPoint) {
+bool SafetyValidator::validateNds(std::string_view data, size_t trimPoint) {
     if (data.size() < 512) return false;
     return validateNdsSectionOffsets(data, trimPoint);
 }
 
 bool SafetyValidator::validateNdsSectionOffsets(
-    const std::string& data, size_t trimPoint)
+    std::string_view data, size_t trimPoint)
 {
+    // Com tamanho declarado no header, basta não cortar nada do que ele lista
+    NdsLayout layout = parseNdsLayout(data);
+    if (layout.valid) {
+        return trimPoint >= layout.dataEnd;
+    }
+
     uint32_t arm9Offset = readU32(data, 0x20);
     uint32_t arm9Size   = readU32(data, 0x2C);
     uint32_t arm7Offset = readU32(data, 0x30);
@@ -67,7 +76,7 @@ bool SafetyValidator::validateNdsSectionOffsets(
 
 // ==================== GB ====================
 
-bool SafetyValidator::validateGb(const std::string&, size_t trimPoint) {
+bool SafetyValidator::validateGb(std::string_view, size_t trimPoint) {
     return validateGbRomSize(trimPoint);
 }
 
@@ -86,10 +95,63 @@ bool SafetyValidator::validateGbRomSize(size_t size) {
     return false;
 }
 
+// ==================== NES ====================
+
+bool SafetyValidator::validateNes(std::string_view data, size_t trimPoint) {
+    if (data.size() < 16) return false;
+
+    // Tamanho declarado: header + trainer + PRG (16KB) + CHR (8KB).
+    // NES 2.0 guarda os bits altos no byte 9; 0xF = forma exponencial,
+    // que não vale a pena decodificar para cortar
+    uint8_t flags7 = static_cast<uint8_t>(data[7]);
+    size_t prgUnits = static_cast<uint8_t>(data[4]);
+    size_t chrUnits = static_cast<uint8_t>(data[5]);
+    if ((flags7 & 0x0C) == 0x08) {
+        uint8_t high = static_cast<uint8_t>(data[9]);
+        if ((high & 0x0F) == 0x0F || (high >> 4) == 0x0F) return false;
+        prgUnits |= static_cast<size_t>(high & 0x0F) << 8;
+        chrUnits |= static_cast<size_t>(high >> 4) << 8;
+    }
+
+    size_t declared = 16 + ((static_cast<uint8_t>(data[6]) & 0x04) ? 512 : 0) +
+                      prgUnits * 16384 + chrUnits * 8192;
+    return trimPoint >= declared;
+}
+
+// ==================== SNES ====================
+
+bool SafetyValidator::validateSnes(std::string_view data, size_t trimPoint) {
+    // O header interno (LoROM 0x7FC0 / HiROM 0xFFC0) tem que ficar
+    SnesLayout layout = parseSnesLayout(data, data.size());
+    return trimPoint >= layout.copierHeader + 0x10000;
+}
+
+// ==================== N64 ====================
+
+bool SafetyValidator::validateN64(std::string_view, size_t trimPoint) {
+    // Boot code (0x40-0x1000) + o primeiro 1MB coberto pelo CRC do header
+    return trimPoint >= 0x101000;
+}
+
+// ==================== MEGA DRIVE ====================
+
+bool SafetyValidator::validateMegaDrive(std::string_view data, size_t trimPoint) {
+    if (trimPoint < 0x200) return false;
+
+    // Endereço final da ROM (big-endian em 0x1A4)
+    if (data.size() < 0x1A8) return true;
+    size_t romEnd = (static_cast<uint32_t>(static_cast<uint8_t>(data[0x1A4])) << 24) |
+                    (static_cast<uint8_t>(data[0x1A5]) << 16) |
+                    (static_cast<uint8_t>(data[0x1A6]) << 8) |
+                     static_cast<uint8_t>(data[0x1A7]);
+    if (romEnd == 0 || romEnd >= data.size()) return true;
+    return trimPoint > romEnd;
+}
+
 // ==================== ESTRUTURAS CONHECIDAS ====================
 
 bool SafetyValidator::validateKnownStructuresInternal(
-    const std::string& data,
+    std::string_view data,
     size_t trimPoint,
     RomType)
 {
@@ -116,7 +178,7 @@ bool SafetyValidator::validateKnownStructuresInternal(
 // ==================== RISCO ====================
 
 SafetyValidator::RiskAssessment SafetyValidator::assessRisk(
-    const std::string& data,
+    std::string_view data,
     size_t trimPoint,
     RomType romType)
 {
@@ -157,12 +219,13 @@ size_t SafetyValidator::getRecommendedSizeForRomType(RomType type) {
     switch (type) {
         case RomType::GBA: return 8 * 1024 * 1024;
         case RomType::NDS: return 64 * 1024 * 1024;
-        case RomType::GB:  return 524288;
+        case RomType::GB:
+        case RomType::GBC: return 524288;
         default:           return 8192;
     }
 }
 
-uint32_t SafetyValidator::readU32(const std::string& data, size_t offset) {
+uint32_t SafetyValidator::readU32(std::string_view data, size_t offset) {
     if (offset + 4 > data.size()) return 0;
 
     return  (uint8_t)data[offset] |
@@ -172,7 +235,7 @@ uint32_t SafetyValidator::readU32(const std::string& data, size_t offset) {
 }
 
 ValidationResult SafetyValidator::validate(
-    const std::string& data,
+    std::string_view data,
     size_t trimPoint,
     RomType romType,
     const TrimOptions& options)
@@ -201,8 +264,21 @@ ValidationResult SafetyValidator::validate(
             ok = validateNds(data, trimPoint);
             break;
         case RomType::GB:
+        case RomType::GBC:
             ok = validateGb(data, trimPoint);
             break;
+        case RomType::NES:
+            ok = validateNes(data, trimPoint);
+            break;
+        case RomType::SNES:
+            ok = validateSnes(data, trimPoint);
+            break;
+        case RomType::N64:
+            ok = validateN64(data, trimPoint);
+            break;
+        case RomType::MEGADRIVE:
+            ok = validateMegaDrive(data, trimPoint);
+            break;
         default:
             result.isValid = false;
             result.message = tr("Unknown ROM type");
@@ -0,0 +1,62 @@
+#include "SnesHeader.hpp"
+
+#include <algorithm>
+#include <utility>
+
+namespace {
+
+uint16_t readU16(std::string_view data, size_t offset) {
+    return static_cast<uint16_t>(static_cast<uint8_t>(data[offset]) |
+                                 (static_cast<uint8_t>(data[offset + 1]) << 8));
+}
+
+// Header interno em base: complemento + checksum e modo de mapa coerente
+bool isInternalHeader(std::string_view data, size_t base, bool hiRom) {
+    if (base + 0x20 > data.size()) {
+        return false;
+    }
+
+    // Complemento + checksum sempre somam 0xFFFF
+    uint16_t complement = readU16(data, base + 0x1C);
+    uint16_t checksum = readU16(data, base + 0x1E);
+    if (static_cast<uint16_t>(complement ^ checksum) != 0xFFFF) {
+        return false;
+    }
+
+    // Modo de mapa 0x2X/0x3X: bit 0 = HiROM (0x23 = SA-1, LoROM)
+    uint8_t mapMode = static_cast<uint8_t>(data[base + 0x15]);
+    if ((mapMode & 0xE0) != 0x20) {
+        return false;
+    }
+    return ((mapMode & 0x01) != 0 && mapMode != 0x23) == hiRom;
+}
+
+} // namespace
+
+SnesLayout parseSnesLayout(std::string_view head, size_t fileSize) {
+    SnesLayout layout;
+
+    // Tamanho % 1024 == 512 sugere copiadora; o header interno decide
+    size_t candidates[] = {0, SNES_COPIER_HEADER_SIZE};
+    if (fileSize % 1024 == SNES_COPIER_HEADER_SIZE) {
+        std::swap(candidates[0], candidates[1]);
+    }
+
+    for (size_t copier : candidates) {
+        if (copier >= fileSize) {
+            continue;
+        }
+        std::string_view payload = head.substr(std::min(copier, head.size()));
+        for (bool hiRom : {false, true}) {
+            size_t offset = hiRom ? 0xFFC0 : 0x7FC0;
+            if (isInternalHeader(payload, offset, hiRom)) {
+                layout.valid = true;
+                layout.copierHeader = copier;
+                layout.headerOffset = offset;
+                layout.hiRom = hiRom;
+                return layout;
+            }
+        }
+    }
+    return layout;
+}
@@ -0,0 +1,221 @@
+#include "TrimEngine.hpp"
+#include "N64ByteOrder.hpp"
+#include "SnesHeader.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <stdexcept>
+#include <unordered_set>
+
+TrimEngine::TrimEngine(const TrimOptions& options) : options(options) {}
+
+TrimReport TrimEngine::analyze(const fs::path& file) {
+    TrimReport report;
+    if (rejectByHeader(file, report)) {
+        return report;
+    }
+
+    try {
+        MappedFile input(file);
+        report = analyzeData(input.view());
+    } catch (const std::exception& e) {
+        report.error = e.what();
+        report.failure = TrimFailure::OPEN_FAILED;
+    }
+    report.path = file;
+    return report;
+}
+
+TrimReport TrimEngine::analyzeData(std::string_view data) {
+    TrimReport report;
+    report.originalSize = data.size();
+    report.trimPoint = data.size();
+
+    if (data.empty()) {
+        report.error = "Arquivo vazio";
+        report.failure = TrimFailure::READ_FAILED;
+        return report;
+    }
+
+    // 1. Tipo
+    report.romType = detector.detect(data);
+    if (report.romType == RomType::UNKNOWN) {
+        report.error = "Tipo de ROM desconhecido";
+        report.failure = TrimFailure::UNKNOWN_TYPE;
+        return report;
+    }
+
+    // Header de copiadora (SNES): o resto só vê o payload, sem cópia
+    if (report.romType == RomType::SNES) {
+        report.headerSize = parseSnesLayout(data, data.size()).copierHeader;
+    }
+    std::string_view payload = data.substr(report.headerSize);
+
+    // 2. Padding (0 = auto, como no CLI: byte e corte na mesma varredura)
+    PaddingAnalysis analysis = options.paddingByte != 0
+                               ? analyzer.analyze(payload, options.paddingByte, report.romType)
+                               : analyzer.analyzeAuto(payload, report.romType);
+    report.paddingByte = analysis.paddingByte;
+    report.hasPadding = analysis.hasPadding;
+    report.confidence = analysis.confidence;
+
+    if (!analysis.hasPadding) {
+        report.safe = true;
+        return report;
+    }
+
+    report.trimPoint = report.headerSize + analysis.trimPoint;
+
+    // 3. Segurança
+    ValidationResult validation = validator.validate(payload, analysis.trimPoint,
+                                                     report.romType, options);
+    report.warnings = validation.warnings;
+    report.safe = validation.isValid;
+
+    if (!validation.isValid) {
+        if (options.force) {
+            report.warnings.push_back("Forçado: " + validation.message);
+        } else {
+            report.error = validation.message;
+            report.failure = TrimFailure::UNSAFE;
+        }
+    }
+
+    return report;
+}
+
+TrimReport TrimEngine::trim(const fs::path& file, const fs::path& outputPath) {
+    TrimReport rejected;
+    if (rejectByHeader(file, rejected)) {
+        return rejected;
+    }
+
+    MappedFile input;
+    try {
+        input.open(file);
+    } catch (const std::exception& e) {
+        TrimReport report;
+        report.path = file;
+        report.error = e.what();
+        report.failure = TrimFailure::OPEN_FAILED;
+        return report;
+    }
+    return trim(input, outputPath);
+}
+
+TrimReport TrimEngine::trim(MappedFile& input, const fs::path& outputPath) {
+    return commit(input, analyzeData(input.view()), outputPath);
+}
+
+TrimReport TrimEngine::commit(MappedFile& input, TrimReport report,
+                              const fs::path& outputPath) {
+    report.path = input.path();
+    report.outputPath = outputPath.empty() ? input.path() : outputPath;
+
+    // Sem padding ainda reescreve se o header de copiadora deve sair
+    bool stripHeader = options.stripCopierHeader && report.headerSize > 0;
+    if (!report.ok() || (!report.hasPadding && !stripHeader)) {
+        return report;
+    }
+
+    // Saída de outra execução: nada é tocado (quem chama decide se é erro)
+    std::error_code ec;
+    bool inPlace = report.path == report.outputPath ||
+                   fs::equivalent(report.path, report.outputPath, ec);
+    if (!inPlace && fs::exists(report.outputPath, ec) && !options.force) {
+        report.error = "Arquivo de saída já existe: " + report.outputPath.string();
+        report.failure = TrimFailure::OUTPUT_EXISTS;
+        return report;
+    }
+
+    try {
+        writeOutput(input, report);
+    } catch (const std::exception& e) {
+        report.error = e.what();
+        report.failure = TrimFailure::WRITE_FAILED;
+    }
+    return report;
+}
+
+bool TrimEngine::rejectByHeader(const fs::path& file, TrimReport& report) {
+    if (detector.probeFile(file).worthReading) {
+        return false;
+    }
+
+    std::error_code ec;
+    report.path = file;
+    report.originalSize = fs::file_size(file, ec);
+    report.trimPoint = report.originalSize;
+    report.error = "Tipo de ROM desconhecido";
+    report.failure = TrimFailure::UNKNOWN_TYPE;
+    return true;
+}
+
+bool TrimEngine::isRomExtension(const fs::path& file) {
+    static const std::unordered_set<std::string> romExtensions = {
+        ".gba", ".nds", ".gb", ".gbc", ".nes", ".smc",
+        ".sfc", ".n64", ".z64", ".v64", ".bin", ".rom"
+    };
+    std::string ext = file.extension().string();
+    std::transform(ext.begin(), ext.end(), ext.begin(), ::tolower);
+    return romExtensions.count(ext) > 0;
+}
+
+void TrimEngine::writeOutput(MappedFile& input, TrimReport& report) {
+    std::error_code ec;
+    bool inPlace = report.path == report.outputPath ||
+                   fs::equivalent(report.path, report.outputPath, ec);
+
+    N64ByteOrder order = options.normalizeN64 ? detectN64ByteOrder(input.view())
+                                              : N64ByteOrder::UNKNOWN;
+    size_t skipBytes = options.stripCopierHeader ? report.headerSize : 0;
+
+    if (inPlace) {
+        // Só o trim in-place destrói o original
+        if (options.backup) {
+            fs::path backupPath = report.path;
+            backupPath += ".bak";
+            fs::copy_file(report.path, backupPath, fs::copy_options::overwrite_existing);
+        }
+
+        if (needsN64Normalization(order) || skipBytes > 0) {
+            // Troca de bytes / header fora reescreve tudo: grava ao lado e substitui
+            fs::path temp = report.path;
+            temp += ".tmp";
+            if (skipBytes > 0) {
+                copyFileRegion(report.path, skipBytes, report.trimPoint - skipBytes, temp);
+            } else {
+                writeN64AsZ64(temp, input.view().substr(0, report.trimPoint), order);
+            }
+            input.close();
+            fs::rename(temp, report.path);
+        } else {
+            // Os bytes mantidos já estão no disco: basta truncar
+            input.close();
+            fs::resize_file(report.path, report.trimPoint);
+        }
+    } else if (needsN64Normalization(order) || skipBytes > 0) {
+        if (report.outputPath.has_parent_path()) {
+            fs::create_directories(report.outputPath.parent_path());
+        }
+        if (skipBytes > 0) {
+            copyFileRegion(report.path, skipBytes, report.trimPoint - skipBytes,
+                           report.outputPath);
+        } else {
+            writeN64AsZ64(report.outputPath, input.view().substr(0, report.trimPoint), order);
+        }
+    } else {
+        if (report.outputPath.has_parent_path()) {
+            fs::create_directories(report.outputPath.parent_path());
+        }
+
+        std::ofstream out(report.outputPath, std::ios::binary | std::ios::trunc);
+        out.write(input.view().data(), static_cast<std::streamsize>(report.trimPoint));
+        out.close();
+        if (!out.good() || fs::file_size(report.outputPath) != report.trimPoint) {
+            throw std::runtime_error("Erro ao escrever: " + report.outputPath.string());
+        }
+    }
+
+    report.trimmed = true;
+}
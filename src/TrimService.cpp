@@ -0,0 +1,406 @@
+#include "TrimService.hpp"
+#include "JsonWriter.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <future>
+#include <sstream>
+#include <thread>
+
+#ifndef _WIN32
+    #include <sys/socket.h>
+    #include <sys/stat.h>
+    #include <sys/un.h>
+    #include <poll.h>
+    #include <unistd.h>
+#endif
+
+#ifndef MSG_NOSIGNAL
+    #define MSG_NOSIGNAL 0 // macOS: sem SIGPIPE por flag
+#endif
+
+namespace {
+    constexpr int POLL_INTERVAL_MS = 250;
+    constexpr size_t MAX_REQUEST_LINE = 1024 * 1024;
+
+    std::vector<std::string> splitFields(const std::string& line) {
+        std::vector<std::string> fields;
+        std::stringstream ss(line);
+        std::string field;
+        while (std::getline(ss, field, '\t')) {
+            if (!field.empty()) {
+                fields.push_back(field);
+            }
+        }
+        return fields;
+    }
+}
+
+// ==================== CONEXÃO ====================
+struct TrimService::Connection {
+    int fd;
+    size_t requests = 0;
+    std::mutex writeMutex;
+    bool broken = false;
+
+    explicit Connection(int fd) : fd(fd) {}
+
+    // Envia uma linha inteira; registros de threads diferentes não se misturam
+    void send(std::string line) {
+        line += '\n';
+        std::lock_guard<std::mutex> lock(writeMutex);
+#ifndef _WIN32
+        const char* data = line.data();
+        size_t remaining = line.size();
+        while (!broken && remaining > 0) {
+            ssize_t sent = ::send(fd, data, remaining, MSG_NOSIGNAL);
+            if (sent < 0 && errno == EINTR) {
+                continue;
+            }
+            if (sent <= 0) {
+                broken = true; // cliente foi embora; o resto é descartado
+                break;
+            }
+            data += sent;
+            remaining -= static_cast<size_t>(sent);
+        }
+#endif
+    }
+};
+
+// ==================== SERVIÇO ====================
+TrimService::TrimService(const TrimOptions& options, Logger& logger, size_t threads)
+    : options(options), logger(logger), engine(options), pool(threads) {}
+
+TrimService::~TrimService() {
+    stopping = true;
+    std::unique_lock<std::mutex> lock(clientsMutex);
+    clientsDone.wait(lock, [this]() { return activeClients == 0; });
+}
+
+bool TrimService::loadDat(const fs::path& datPath) {
+    try {
+        catalog = DatCatalog::load(datPath.string());
+    } catch (const std::exception& e) {
+        catalog = DatCatalog();
+    }
+    if (catalog.empty()) {
+        LOG_ERROR(logger, "DAT vazio ou inválido: " + datPath.string());
+        return false;
+    }
+
+    LOG_INFO(logger, "DAT carregado: " + std::to_string(catalog.size()) +
+                     " entradas (" + datPath.string() + ")");
+    return true;
+}
+
+bool TrimService::serve(const fs::path& socketPath,
+                        const std::function<bool()>& stopRequested) {
+#ifdef _WIN32
+    (void)socketPath;
+    (void)stopRequested;
+    LOG_ERROR(logger, "--serve requer sockets Unix");
+    return false;
+#else
+    sockaddr_un address{};
+    address.sun_family = AF_UNIX;
+
+    std::string path = socketPath.string();
+    if (path.empty() || path.size() >= sizeof(address.sun_path)) {
+        LOG_ERROR(logger, "Caminho de socket inválido ou longo demais: " + path);
+        return false;
+    }
+    std::memcpy(address.sun_path, path.c_str(), path.size() + 1);
+
+    int listenFd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+    if (listenFd < 0) {
+        LOG_ERROR(logger, std::string("socket() falhou: ") + std::strerror(errno));
+        return false;
+    }
+
+    // Socket órfão de uma execução anterior
+    std::error_code ec;
+    if (fs::is_socket(socketPath, ec)) {
+        fs::remove(socketPath, ec);
+    }
+
+    // O socket já nasce 0660: com chmod depois do bind haveria uma janela
+    // em que qualquer usuário conseguiria conectar
+    mode_t previousMask = ::umask(0117);
+    int bound = ::bind(listenFd, reinterpret_cast<sockaddr*>(&address), sizeof(address));
+    int bindError = errno;
+    ::umask(previousMask);
+
+    if (bound < 0 || ::listen(listenFd, 64) < 0) {
+        if (bound < 0) {
+            errno = bindError;
+        }
+        LOG_ERROR(logger, "Não foi possível escutar em " + path + ": " + std::strerror(errno));
+        ::close(listenFd);
+        return false;
+    }
+
+    LOG_INFO(logger, "Servindo em " + path + " (" + std::to_string(pool.size()) +
+                     " threads, Ctrl+C para encerrar)");
+
+    while (!stopRequested()) {
+        pollfd pfd{listenFd, POLLIN, 0};
+        if (::poll(&pfd, 1, POLL_INTERVAL_MS) <= 0) {
+            continue;
+        }
+
+        int clientFd = ::accept(listenFd, nullptr, nullptr);
+        if (clientFd < 0) {
+            continue;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(clientsMutex);
+            ++activeClients;
+        }
+        std::thread([this, clientFd]() { handleClient(clientFd); }).detach();
+    }
+
+    stopping = true;
+    ::close(listenFd);
+    fs::remove(socketPath, ec);
+
+    {
+        std::unique_lock<std::mutex> lock(clientsMutex);
+        clientsDone.wait(lock, [this]() { return activeClients == 0; });
+    }
+
+    LOG_INFO(logger, "Serviço encerrado");
+    return true;
+#endif
+}
+
+void TrimService::handleClient(int fd) {
+#ifndef _WIN32
+    Connection connection(fd);
+    std::string buffer;
+    char chunk[4096];
+    bool open = true;
+
+    while (open && !stopping && !connection.broken) {
+        pollfd pfd{fd, POLLIN, 0};
+        int ready = ::poll(&pfd, 1, POLL_INTERVAL_MS);
+        if (ready == 0 || (ready < 0 && errno == EINTR)) {
+            continue;
+        }
+        if (ready < 0) {
+            break;
+        }
+
+        ssize_t received = ::recv(fd, chunk, sizeof(chunk), 0);
+        if (received <= 0) {
+            break;
+        }
+        buffer.append(chunk, static_cast<size_t>(received));
+
+        size_t newline;
+        while (open && (newline = buffer.find('\n')) != std::string::npos) {
+            std::string line = buffer.substr(0, newline);
+            buffer.erase(0, newline + 1);
+            if (!line.empty() && line.back() == '\r') {
+                line.pop_back();
+            }
+
+            if (line == "quit") {
+                open = false;
+            } else if (!line.empty()) {
+                handleRequest(connection, line);
+            }
+        }
+
+        if (buffer.size() > MAX_REQUEST_LINE) {
+            connection.send(JsonWriter().field("error", "requisição longa demais").finish());
+            break;
+        }
+    }
+
+    ::close(fd);
+#else
+    (void)fd;
+#endif
+
+    std::lock_guard<std::mutex> lock(clientsMutex);
+    --activeClients;
+    clientsDone.notify_all();
+}
+
+void TrimService::handleRequest(Connection& connection, const std::string& line) {
+    size_t request = ++connection.requests;
+    std::vector<std::string> fields = splitFields(line);
+    const std::string op = fields.empty() ? std::string() : fields[0];
+
+    auto finish = [&](size_t files, size_t failed) {
+        connection.send(JsonWriter()
+                        .field("req", request)
+                        .field("done", true)
+                        .field("files", files)
+                        .field("failed", failed)
+                        .finish());
+    };
+
+    if (op == "ping") {
+        connection.send(JsonWriter().field("req", request).field("pong", true).finish());
+        finish(0, 0);
+        return;
+    }
+
+    if (op != "analyze" && op != "trim" && op != "verify") {
+        connection.send(JsonWriter()
+                        .field("req", request)
+                        .field("error", "comando desconhecido: " + op)
+                        .finish());
+        finish(0, 0);
+        return;
+    }
+
+    // TAB e quebra de linha são separadores do protocolo: um caminho com
+    // eles já chegou partido. Outros caracteres de controle são recusados
+    // em vez de virarem um caminho que não é o que o cliente quis mandar
+    for (size_t i = 1; i < fields.size(); ++i) {
+        bool control = std::any_of(fields[i].begin(), fields[i].end(), [](char c) {
+            return static_cast<unsigned char>(c) < 0x20 || c == 0x7F;
+        });
+        if (control) {
+            connection.send(JsonWriter()
+                            .field("req", request)
+                            .field("error", "caminho com caractere de controle: campo " +
+                                            std::to_string(i))
+                            .finish());
+            finish(0, 0);
+            return;
+        }
+    }
+
+    // Cada arquivo vai para o pool; o registro sai assim que ele termina
+    std::vector<std::future<bool>> results;
+    results.reserve(fields.size() - 1);
+
+    for (size_t i = 1; i < fields.size(); ++i) {
+        fs::path file = fields[i];
+        if (op == "verify") {
+            results.push_back(pool.enqueue([this, &connection, request, file]() {
+                return runVerify(connection, request, file);
+            }));
+        } else {
+            results.push_back(pool.enqueue([this, &connection, request, op, file]() {
+                return runAnalyze(connection, request, op, file);
+            }));
+        }
+    }
+
+    size_t failed = 0;
+    for (auto& result : results) {
+        try {
+            if (!result.get()) {
+                ++failed;
+            }
+        } catch (const std::exception&) {
+            ++failed;
+        }
+    }
+    finish(results.size(), failed);
+}
+
+bool TrimService::runAnalyze(Connection& connection, size_t request,
+                             const std::string& op, const fs::path& file) {
+    TrimReport report;
+    if (op == "trim") {
+        fs::path output = options.outputDir.empty()
+                          ? fs::path()
+                          : options.outputDir / file.filename();
+        report = engine.trim(file, output);
+    } else {
+        report = engine.analyze(file);
+    }
+
+    JsonWriter json;
+    json.field("req", request)
+        .field("op", op)
+        .field("path", report.path.string())
+        .field("ok", report.ok())
+        .field("rom_type", romTypeName(report.romType))
+        .field("padding_byte", static_cast<unsigned>(report.paddingByte))
+        .field("original_size", report.originalSize)
+        .field("trim_point", report.trimPoint)
+        .field("saved_bytes", report.originalSize - report.trimPoint)
+        .field("confidence", report.confidence)
+        .field("safe", report.safe)
+        .field("trimmed", report.trimmed);
+
+    if (report.trimmed) {
+        json.field("output", report.outputPath.string());
+    }
+    if (!report.warnings.empty()) {
+        json.stringArray("warnings", report.warnings);
+    }
+    if (!report.ok()) {
+        json.field("error", report.error);
+    }
+
+    connection.send(json.finish());
+    return report.ok();
+}
+
+bool TrimService::runVerify(Connection& connection, size_t request, const fs::path& file) {
+    JsonWriter json;
+    json.field("req", request).field("op", "verify").field("path", file.string());
+
+    if (catalog.empty()) {
+        connection.send(json.field("ok", false)
+                            .field("error", "nenhum DAT carregado (--dat)")
+                            .finish());
+        return false;
+    }
+
+    ChecksumVerifier::Digests digests;
+    if (!DatIntegrator::calculateDigests(file.string(), digests)) {
+        connection.send(json.field("ok", false)
+                            .field("error", "Não foi possível ler o arquivo")
+                            .finish());
+        return false;
+    }
+
+    DatCatalog::Sha1 sha1;
+    size_t match = DatCatalog::npos;
+    if (DatCatalog::parseHex(digests.sha1, sha1.data(), sha1.size())) {
+        match = catalog.findBySha1(sha1);
+    }
+    if (match == DatCatalog::npos) {
+        match = catalog.findByCrc32(digests.crc32);
+    }
+
+    std::string status = "unknown";
+    uint8_t paddingByte = 0;
+    if (match != DatCatalog::npos && catalog.matches(match, digests)) {
+        status = "ok";
+    } else if (match == DatCatalog::npos &&
+               (match = catalog.findByName(file.filename().string())) != DatCatalog::npos) {
+        // Mesmo nome, hashes diferentes: pode ser a ROM já aparada
+        status = DatIntegrator::verifyTrimmedRom(file.string(), catalog.entry(match), &paddingByte)
+                 ? "trimmed" : "modified";
+    } else if (match != DatCatalog::npos) {
+        status = "modified";
+    }
+
+    json.field("ok", true)
+        .field("status", status)
+        .field("size", std::to_string(digests.size))
+        .field("crc32", digests.crc32Hex)
+        .field("md5", digests.md5)
+        .field("sha1", digests.sha1);
+    if (match != DatCatalog::npos) {
+        json.field("dat_name", std::string(catalog.name(match)));
+    }
+    if (status == "trimmed") {
+        json.field("padding_byte", static_cast<unsigned>(paddingByte));
+    }
+
+    connection.send(json.finish());
+    return true;
+}
@@ -112,10 +112,28 @@ std::string setupLocalization(ConfigManager& config, int argc, char* argv[]) {
     return langCode;
 }
 
+// ==================== SAÍDA ESTRUTURADA ====================
+// --format ndjson reserva stdout para os registros JSON
+bool wantsNdjsonOutput(int argc, char* argv[]) {
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--format=ndjson") == 0) return true;
+        if (std::strcmp(argv[i], "--format") == 0 && i + 1 < argc &&
+            std::strcmp(argv[i + 1], "ndjson") == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
 // ==================== FUNÇÃO PRINCIPAL ====================
 int main(int argc, char* argv[]) {
     g_emergencyLogger = std::make_unique<Logger>();
 
+    // Banner, logs e resumo em texto passam a ir para stderr
+    if (wantsNdjsonOutput(argc, argv)) {
+        std::cout.rdbuf(std::cerr.rdbuf());
+    }
+
     try {
         // Banner inicial
         std::cout << "\n"
@@ -167,12 +185,12 @@ if (langInConfig == "unset") {
     } catch (const std::exception& e) {
         std::cerr << "\n❌ " << TR("CRITICAL_ERROR") << ": " << e.what() << std::endl;
         if (g_emergencyLogger)
-            g_emergencyLogger->log("Exceção não tratada: " + std::string(e.what()), LogLevel::ERROR);
+            LOG_ERROR(*g_emergencyLogger, "Exceção não tratada: " + std::string(e.what()));
         return EXIT_FAILURE;
     } catch (...) {
         std::cerr << "\n❌ " << TR("UNKNOWN_ERROR") << std::endl;
         if (g_emergencyLogger)
-            g_emergencyLogger->log("Erro desconhecido não tratado", LogLevel::ERROR);
+            LOG_ERROR(*g_emergencyLogger, "Erro desconhecido não tratado");
         return EXIT_FAILURE;
     }
 }
@@ -1,71 +1,608 @@
 // romtrimmer_c.cpp - C++ implementation of C interface
 #include "romtrimmer_c.h"
-#include <zlib.h>
 #include "RomTrimmer.hpp"
-#include "PaddingAnalyzer.hpp"
-#include "RomDetector.hpp"
-#include "SafetyValidator.hpp"
+#include "TrimEngine.hpp"
+#include "MappedFile.hpp"
+#include "ThreadPool.hpp"
+#include "ReversePadding.hpp"
+#include "ConfigManager.hpp"
+#include "DatIntegration.hpp"
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <future>
 #include <memory>
+#include <mutex>
+#include <thread>
 #include <vector>
 
 struct rt_context {
-    std::unique_ptr<RomTrimmer> trimmer;
-    std::unique_ptr<RomDetector> detector;
-    std::unique_ptr<PaddingAnalyzer> analyzer;
-    std::unique_ptr<SafetyValidator> validator;
+    rt_config_t config;
+    TrimEngine engine;
+    MappedFile file;                   // reused by single-file calls
+    std::unique_ptr<ThreadPool> pool;  // created on the first batch
+
+    rt_context(const rt_config_t& config, const TrimOptions& options)
+        : config(config), engine(options) {}
+};
+
+// Background directory job. The runner thread lists the directory and
+// feeds the context pool as it goes, so work starts before listing ends.
+struct rt_job {
+    rt_context_t* ctx;
+    fs::path directory;
+    bool recursive;
+    rt_file_callback_t callback;
+    void* userData;
+
+    std::atomic<bool> cancelRequested{false};
+    std::atomic<size_t> total{0}, done{0}, trimmed{0}, skipped{0}, failed{0};
+    std::atomic<size_t> saved{0}, bytesProcessed{0};
+    std::atomic<int> firstError{RT_SUCCESS};
+
+    std::chrono::steady_clock::time_point started = std::chrono::steady_clock::now();
+    std::chrono::steady_clock::time_point ended;
+
+    std::mutex stateMutex;
+    std::condition_variable finishedCondition;
+    bool finished = false;
+    rt_error_t result = RT_SUCCESS;
+
+    std::thread runner;
+
+    rt_job(rt_context_t* ctx, fs::path directory, bool recursive,
+           rt_file_callback_t callback, void* userData)
+        : ctx(ctx), directory(std::move(directory)), recursive(recursive),
+          callback(callback), userData(userData) {}
+
+    void run();
+    void processFile(const fs::path& file);
+    void snapshot(rt_job_progress_t* progress) const;  // stateMutex held
 };
 
-// Simple C++ to C wrapper implementation
+namespace {
+
+std::mutex g_configMutex;
+rt_config_t g_config;
+bool g_initialized = false;
+
+void defaultConfig(rt_config_t* config) {
+    config->create_backup = true;
+    config->force = false;
+    config->analyze_only = false;
+    config->padding_byte = 0;
+    config->min_size = 1024;
+    config->safety_margin = 64 * 1024;
+    config->max_cut_ratio = 0.6;
+}
+
+rt_config_t currentConfig() {
+    std::lock_guard<std::mutex> lock(g_configMutex);
+    if (!g_initialized) {
+        defaultConfig(&g_config);
+        g_initialized = true;
+    }
+    return g_config;
+}
+
+TrimOptions toOptions(const rt_config_t& config) {
+    TrimOptions options;
+    options.backup = config.create_backup;
+    options.force = config.force;
+    options.analyzeOnly = config.analyze_only;
+    options.paddingByte = config.padding_byte;
+    options.minSize = config.min_size;
+    options.safetyMargin = config.safety_margin;
+    options.maxCutRatio = config.max_cut_ratio;
+    return options;
+}
+
+rt_rom_type_t toCRomType(RomType type) {
+    switch (type) {
+        case RomType::GBA: return RT_ROM_GBA;
+        case RomType::NDS: return RT_ROM_NDS;
+        case RomType::GB:  return RT_ROM_GB;
+        case RomType::GBC: return RT_ROM_GBC;
+        case RomType::NES: return RT_ROM_NES;
+        case RomType::SNES: return RT_ROM_SNES;
+        case RomType::N64: return RT_ROM_N64;
+        case RomType::MEGADRIVE: return RT_ROM_MD;
+        default:           return RT_ROM_UNKNOWN;
+    }
+}
+
+rt_error_t toCError(const TrimReport& report) {
+    switch (report.failure) {
+        case TrimFailure::NONE:         return RT_SUCCESS;
+        case TrimFailure::OPEN_FAILED:  return RT_ERROR_FILE_NOT_FOUND;
+        case TrimFailure::READ_FAILED:  return RT_ERROR_READ_FAILED;
+        case TrimFailure::UNKNOWN_TYPE: return RT_ERROR_UNSUPPORTED_FORMAT;
+        case TrimFailure::UNSAFE:       return RT_ERROR_VALIDATION_FAILED;
+        case TrimFailure::OUTPUT_EXISTS:
+        case TrimFailure::WRITE_FAILED: return RT_ERROR_WRITE_FAILED;
+    }
+    return RT_ERROR_READ_FAILED;
+}
+
+void fillResult(const TrimReport& report, rt_analysis_result_t* result) {
+    if (!result) return;
+
+    std::memset(result, 0, sizeof(*result));
+    result->has_padding = report.hasPadding;
+    result->original_size = report.originalSize;
+    result->trimmed_size = report.trimPoint;
+    result->padding_bytes = report.originalSize - report.trimPoint;
+    result->saved_percentage = report.originalSize
+        ? 100.0 * (1.0 - static_cast<double>(report.trimPoint) / report.originalSize)
+        : 0.0;
+    result->rom_type = toCRomType(report.romType);
+    std::strncpy(result->rom_type_str, romTypeName(report.romType),
+                 sizeof(result->rom_type_str) - 1);
+    result->validation_passed = report.safe;
+}
+
+// Runs fn with a temporary context built from the global config
+template <typename Fn>
+rt_error_t withDefaultContext(const rt_config_t* config, Fn&& fn) {
+    rt_config_t effective = config ? *config : currentConfig();
+    std::unique_ptr<rt_context_t, void (*)(rt_context_t*)> ctx(
+        rt_context_create(&effective), rt_context_destroy);
+    if (!ctx) return RT_ERROR_INVALID_PARAM;
+    return fn(ctx.get());
+}
+
+} // namespace
+
+void rt_job::processFile(const fs::path& file) {
+    // Cooperative cancel: checked only between files
+    if (cancelRequested) return;
+
+    TrimReport report = ctx->config.analyze_only ? ctx->engine.analyze(file)
+                                                 : ctx->engine.trim(file);
+    rt_error_t error = toCError(report);
+
+    if (report.failure == TrimFailure::UNKNOWN_TYPE) {
+        skipped++;
+    } else if (!report.ok()) {
+        failed++;
+        int expected = RT_SUCCESS;
+        firstError.compare_exchange_strong(expected, error);
+    } else if (report.trimmed) {
+        trimmed++;
+        saved += report.originalSize - report.trimPoint;
+    }
+    bytesProcessed += report.originalSize;
+    done++;
+
+    if (callback) {
+        rt_analysis_result_t result;
+        fillResult(report, &result);
+        callback(file.string().c_str(), error, &result, userData);
+    }
+}
+
+void rt_job::run() {
+    std::vector<std::future<void>> pending;
+
+    try {
+        auto submit = [this, &pending](const fs::directory_entry& entry) {
+            if (entry.is_regular_file() && TrimEngine::isRomExtension(entry.path())) {
+                total++;
+                pending.push_back(ctx->pool->enqueue([this, file = entry.path()]() {
+                    processFile(file);
+                }));
+            }
+        };
+        if (recursive) {
+            for (const auto& entry : fs::recursive_directory_iterator(directory)) {
+                if (cancelRequested) break;
+                submit(entry);
+            }
+        } else {
+            for (const auto& entry : fs::directory_iterator(directory)) {
+                if (cancelRequested) break;
+                submit(entry);
+            }
+        }
+    } catch (...) {
+        int expected = RT_SUCCESS;
+        firstError.compare_exchange_strong(expected, RT_ERROR_READ_FAILED);
+    }
+
+    for (auto& task : pending) {
+        task.wait();
+    }
+
+    std::lock_guard<std::mutex> lock(stateMutex);
+    ended = std::chrono::steady_clock::now();
+    result = cancelRequested ? RT_ERROR_CANCELLED : static_cast<rt_error_t>(firstError.load());
+    finished = true;
+    finishedCondition.notify_all();
+}
+
+void rt_job::snapshot(rt_job_progress_t* progress) const {
+    auto now = finished ? ended : std::chrono::steady_clock::now();
+    double elapsed = std::chrono::duration<double>(now - started).count();
+
+    progress->state = !finished ? RT_JOB_RUNNING
+                    : result == RT_ERROR_CANCELLED ? RT_JOB_CANCELLED
+                    : RT_JOB_FINISHED;
+    progress->stats.files_total = total;
+    progress->stats.files_trimmed = trimmed;
+    progress->stats.files_skipped = skipped;
+    progress->stats.files_failed = failed;
+    progress->stats.bytes_saved = saved;
+    progress->files_done = done;
+    progress->bytes_processed = bytesProcessed;
+    progress->elapsed_seconds = elapsed;
+    progress->files_per_second = elapsed > 0 ? progress->files_done / elapsed : 0.0;
+    progress->bytes_per_second = elapsed > 0 ? progress->bytes_processed / elapsed : 0.0;
+}
+
 extern "C" {
-    
+
+// ==================== INIT / CONFIG ====================
+
+rt_error_t rt_init() {
+    std::lock_guard<std::mutex> lock(g_configMutex);
+    defaultConfig(&g_config);
+    g_initialized = true;
+    return RT_SUCCESS;
+}
+
+void rt_cleanup() {
+    std::lock_guard<std::mutex> lock(g_configMutex);
+    g_initialized = false;
+}
+
+void rt_set_default_config(rt_config_t* config) {
+    if (config) defaultConfig(config);
+}
+
+rt_error_t rt_load_config(const char* config_file) {
+    if (!config_file) return RT_ERROR_INVALID_PARAM;
+    if (!fs::exists(config_file)) return RT_ERROR_FILE_NOT_FOUND;
+
+    ConfigManager manager;
+    if (!manager.loadConfig(config_file)) return RT_ERROR_READ_FAILED;
+
+    rt_config_t config;
+    defaultConfig(&config);
+    config.create_backup = manager.getBool("general.create_backup", config.create_backup);
+    config.min_size = manager.getInt("safety.min_size", static_cast<int>(config.min_size));
+    config.safety_margin = manager.getInt("safety.margin", static_cast<int>(config.safety_margin));
+    config.max_cut_ratio = manager.getDouble("safety.max_cut_ratio", config.max_cut_ratio);
+
+    std::string padding = manager.getString("general.default_padding", "auto");
+    if (padding == "0xFF" || padding == "FF") config.padding_byte = 0xFF;
+    else if (padding == "0x00" || padding == "00") config.padding_byte = 0x00;
+
+    std::lock_guard<std::mutex> lock(g_configMutex);
+    g_config = config;
+    g_initialized = true;
+    return RT_SUCCESS;
+}
+
+// ==================== CONTEXT ====================
+
+rt_context_t* rt_context_create(const rt_config_t* config) {
+    try {
+        rt_config_t effective = config ? *config : currentConfig();
+        return new rt_context(effective, toOptions(effective));
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+void rt_context_destroy(rt_context_t* ctx) {
+    delete ctx;
+}
+
+rt_error_t rt_context_analyze_memory(rt_context_t* ctx, const uint8_t* data, size_t size,
+                                     rt_analysis_result_t* result) {
+    if (!ctx || !result || (!data && size)) return RT_ERROR_INVALID_PARAM;
+
+    try {
+        TrimReport report = ctx->engine.analyzeData(
+            std::string_view(reinterpret_cast<const char*>(data), size));
+        fillResult(report, result);
+        return toCError(report);
+    } catch (...) {
+        return RT_ERROR_READ_FAILED;
+    }
+}
+
+rt_error_t rt_context_analyze_file(rt_context_t* ctx, const char* filename,
+                                   rt_analysis_result_t* result) {
+    if (!ctx || !filename || !result) return RT_ERROR_INVALID_PARAM;
+
+    try {
+        ctx->file.open(filename);
+    } catch (...) {
+        return RT_ERROR_FILE_NOT_FOUND;
+    }
+
+    rt_error_t error = rt_context_analyze_memory(
+        ctx, reinterpret_cast<const uint8_t*>(ctx->file.view().data()),
+        ctx->file.size(), result);
+    ctx->file.close();
+    return error;
+}
+
+rt_error_t rt_context_trim_file(rt_context_t* ctx, const char* input_file,
+                                const char* output_file, rt_analysis_result_t* result) {
+    if (!ctx || !input_file) return RT_ERROR_INVALID_PARAM;
+
+    if (ctx->config.analyze_only) {
+        rt_analysis_result_t local;
+        return rt_context_analyze_file(ctx, input_file, result ? result : &local);
+    }
+
+    try {
+        ctx->file.open(input_file);
+    } catch (...) {
+        return RT_ERROR_FILE_NOT_FOUND;
+    }
+
+    try {
+        TrimReport report = ctx->engine.trim(ctx->file, output_file ? fs::path(output_file)
+                                                                    : fs::path());
+        ctx->file.close();
+        fillResult(report, result);
+        return toCError(report);
+    } catch (...) {
+        ctx->file.close();
+        return RT_ERROR_WRITE_FAILED;
+    }
+}
+
+rt_error_t rt_context_process_directory(rt_context_t* ctx, const char* directory,
+                                        bool recursive, unsigned threads,
+                                        rt_batch_stats_t* stats) {
+    rt_job_t* job = nullptr;
+    rt_error_t error = rt_job_start(ctx, directory, recursive, threads,
+                                    nullptr, nullptr, &job);
+    if (error != RT_SUCCESS) return error;
+
+    rt_job_progress_t progress;
+    error = rt_job_wait(job, &progress);
+    rt_job_destroy(job);
+
+    if (stats) *stats = progress.stats;
+    return error;
+}
+
+// ==================== JOBS ====================
+
+rt_error_t rt_job_start(rt_context_t* ctx, const char* directory, bool recursive,
+                        unsigned threads, rt_file_callback_t callback,
+                        void* user_data, rt_job_t** job) {
+    if (!ctx || !directory || !job) return RT_ERROR_INVALID_PARAM;
+    *job = nullptr;
+    if (!fs::is_directory(directory)) return RT_ERROR_FILE_NOT_FOUND;
+
+    try {
+        size_t workers = threads ? threads : std::max(1u, std::thread::hardware_concurrency());
+        if (!ctx->pool || ctx->pool->size() != workers) {
+            ctx->pool = std::make_unique<ThreadPool>(workers);
+        }
+
+        auto created = std::make_unique<rt_job>(ctx, directory, recursive, callback, user_data);
+        created->runner = std::thread(&rt_job::run, created.get());
+        *job = created.release();
+        return RT_SUCCESS;
+    } catch (...) {
+        return RT_ERROR_INVALID_PARAM;
+    }
+}
+
+rt_error_t rt_job_poll(rt_job_t* job, rt_job_progress_t* progress) {
+    if (!job) return RT_ERROR_INVALID_PARAM;
+
+    std::lock_guard<std::mutex> lock(job->stateMutex);
+    if (progress) job->snapshot(progress);
+    return job->finished ? job->result : RT_ERROR_IN_PROGRESS;
+}
+
+void rt_job_cancel(rt_job_t* job) {
+    if (job) job->cancelRequested = true;
+}
+
+rt_error_t rt_job_wait(rt_job_t* job, rt_job_progress_t* progress) {
+    if (!job) return RT_ERROR_INVALID_PARAM;
+
+    std::unique_lock<std::mutex> lock(job->stateMutex);
+    job->finishedCondition.wait(lock, [job] { return job->finished; });
+    if (progress) job->snapshot(progress);
+    return job->result;
+}
+
+void rt_job_destroy(rt_job_t* job) {
+    if (!job) return;
+    job->cancelRequested = true;
+    if (job->runner.joinable()) job->runner.join();
+    delete job;
+}
+
+// ==================== CORE FUNCTIONS ====================
+
 rt_error_t rt_analyze_file(const char* filename, rt_analysis_result_t* result) {
     if (!filename || !result) return RT_ERROR_INVALID_PARAM;
-    
+    return withDefaultContext(nullptr, [&](rt_context_t* ctx) {
+        return rt_context_analyze_file(ctx, filename, result);
+    });
+}
+
+rt_error_t rt_trim_file(const char* input_file, const char* output_file,
+                        const rt_config_t* config, rt_analysis_result_t* result) {
+    if (!input_file) return RT_ERROR_INVALID_PARAM;
+    return withDefaultContext(config, [&](rt_context_t* ctx) {
+        return rt_context_trim_file(ctx, input_file, output_file, result);
+    });
+}
+
+rt_error_t rt_trim_memory(const uint8_t* data, size_t size,
+                          uint8_t** trimmed_data, size_t* trimmed_size,
+                          const rt_config_t* config) {
+    if (!data || !trimmed_size) return RT_ERROR_INVALID_PARAM;
+
+    return withDefaultContext(config, [&](rt_context_t* ctx) {
+        rt_analysis_result_t result;
+        rt_error_t error = rt_context_analyze_memory(ctx, data, size, &result);
+        if (error != RT_SUCCESS) return error;
+
+        *trimmed_size = result.trimmed_size;
+
+        // Prefix of the caller's buffer: copy only if asked to
+        if (trimmed_data) {
+            *trimmed_data = static_cast<uint8_t*>(std::malloc(result.trimmed_size ? result.trimmed_size : 1));
+            if (!*trimmed_data) return RT_ERROR_WRITE_FAILED;
+            std::memcpy(*trimmed_data, data, result.trimmed_size);
+        }
+        return RT_SUCCESS;
+    });
+}
+
+// ==================== CHECKSUMS ====================
+
+namespace {
+
+void fillChecksums(const ChecksumVerifier::Digests& digests, rt_checksums_t* result) {
+    std::memset(result, 0, sizeof(*result));
+    result->size = digests.size;
+    result->crc32 = digests.crc32;
+    std::strncpy(result->md5, digests.md5.c_str(), sizeof(result->md5) - 1);
+    std::strncpy(result->sha1, digests.sha1.c_str(), sizeof(result->sha1) - 1);
+    std::strncpy(result->sha256, digests.sha256.c_str(), sizeof(result->sha256) - 1);
+}
+
+} // namespace
+
+rt_error_t rt_checksum_file(const char* filename, rt_checksums_t* result) {
+    if (!filename || !result) return RT_ERROR_INVALID_PARAM;
+    if (!fs::exists(filename)) return RT_ERROR_FILE_NOT_FOUND;
+
     try {
-        // Read file
-        std::ifstream file(filename, std::ios::binary | std::ios::ate);
-        if (!file) return RT_ERROR_FILE_NOT_FOUND;
-        
-        size_t size = file.tellg();
-        file.seekg(0);
-        std::vector<uint8_t> data(size);
-        file.read(reinterpret_cast<char*>(data.data()), size);
-        
-        // Convert to string for existing API
-        std::string data_str(data.begin(), data.end());
-        
-        // Detect ROM type
-        RomDetector detector;
-        RomType romType = detector.detect(data_str);
-        
-        // Map to C enum
-        switch (romType) {
-            case RomType::GBA: result->rom_type = RT_ROM_GBA; break;
-            case RomType::NDS: result->rom_type = RT_ROM_NDS; break;
-            case RomType::GB: result->rom_type = RT_ROM_GB; break;
-            case RomType::GBC: result->rom_type = RT_ROM_GBC; break;
-            default: result->rom_type = RT_ROM_UNKNOWN; break;
+        ChecksumVerifier::Digests digests;
+        if (!DatIntegrator::calculateDigests(filename, digests, true)) {
+            return RT_ERROR_READ_FAILED;
         }
-        
-        // Analyze padding
-        PaddingAnalyzer analyzer;
-        auto padding_byte = analyzer.autoDetectPadding(data_str, romType);
-        auto analysis = analyzer.analyze(data_str, padding_byte);
-        
-        // Fill result
-        result->original_size = data_str.size();
-        result->has_padding = analysis.hasPadding;
-        result->trimmed_size = analysis.trimPoint;
-        result->padding_bytes = analysis.paddingSize;
-        result->saved_percentage = 100.0 * (1.0 - (double)result->trimmed_size / result->original_size);
-        
+        fillChecksums(digests, result);
+        return RT_SUCCESS;
+    } catch (...) {
+        return RT_ERROR_READ_FAILED;
+    }
+}
+
+rt_error_t rt_checksum_memory(const uint8_t* data, size_t size, rt_checksums_t* result) {
+    if ((!data && size > 0) || !result) return RT_ERROR_INVALID_PARAM;
+
+    try {
+        ChecksumVerifier::Stream stream(true);
+        stream.update(data, size);
+        fillChecksums(stream.finish(), result);
         return RT_SUCCESS;
-        
     } catch (...) {
         return RT_ERROR_READ_FAILED;
     }
 }
-    
-// Other C interface implementations...
+
+// ==================== BATCH ====================
+
+rt_error_t rt_process_directory(const char* directory, const rt_config_t* config,
+                                bool recursive) {
+    if (!directory) return RT_ERROR_INVALID_PARAM;
+    return withDefaultContext(config, [&](rt_context_t* ctx) {
+        return rt_context_process_directory(ctx, directory, recursive, 0, nullptr);
+    });
+}
+
+rt_error_t rt_process_archive(const char* archive_file, const rt_config_t* config,
+                             const char* extract_dir) {
+    if (!archive_file) return RT_ERROR_INVALID_PARAM;
+
+    fs::path archive(archive_file);
+    if (!fs::exists(archive)) return RT_ERROR_FILE_NOT_FOUND;
+
+    fs::path target = extract_dir
+        ? fs::path(extract_dir)
+        : fs::temp_directory_path() / ("romtrimmer_" + archive.stem().string());
+
+    try {
+        fs::create_directories(target);
+
+        std::string ext = archive.extension().string();
+        std::transform(ext.begin(), ext.end(), ext.begin(), ::tolower);
+
+        RomTrimmer extractor;
+        bool extracted = false;
+        if (ext == ".zip") extracted = extractor.extractZipArchive(archive, target);
+        else if (ext == ".7z") extracted = extractor.extract7zArchive(archive, target);
+        else if (ext == ".rar") extracted = extractor.extractRarArchive(archive, target);
+        else return RT_ERROR_UNSUPPORTED_FORMAT;
+
+        if (!extracted) return RT_ERROR_READ_FAILED;
+    } catch (...) {
+        return RT_ERROR_WRITE_FAILED;
+    }
+
+    return rt_process_directory(target.string().c_str(), config, true);
+}
+
+// ==================== PATCHES ====================
+
+rt_error_t rt_generate_patch(const char* original_file, const char* trimmed_file,
+                            const char* patch_file) {
+    if (!original_file || !trimmed_file || !patch_file) return RT_ERROR_INVALID_PARAM;
+
+    try {
+        MappedFile original(original_file);
+        MappedFile trimmed(trimmed_file);
+
+        std::string_view originalData = original.view();
+        std::string_view trimmedData = trimmed.view();
+        if (originalData.size() <= trimmedData.size() ||
+            originalData.substr(0, trimmedData.size()) != trimmedData) {
+            return RT_ERROR_VALIDATION_FAILED;
+        }
+
+        auto padding = static_cast<uint8_t>(originalData.back());
+        auto patch = ReversePadding::createRestorationPatch(originalData, trimmedData, padding);
+        if (patch.empty()) return RT_ERROR_VALIDATION_FAILED;
+
+        return ReversePadding::savePatch(patch, patch_file) ? RT_SUCCESS : RT_ERROR_WRITE_FAILED;
+    } catch (...) {
+        return RT_ERROR_FILE_NOT_FOUND;
+    }
 }
+
+rt_error_t rt_apply_patch(const char* trimmed_file, const char* patch_file,
+                         const char* restored_file) {
+    if (!trimmed_file || !patch_file || !restored_file) return RT_ERROR_INVALID_PARAM;
+
+    try {
+        auto patch = ReversePadding::loadPatch(patch_file);
+        if (patch.empty()) return RT_ERROR_READ_FAILED;
+
+        MappedFile trimmed(trimmed_file);
+        std::string restored = ReversePadding::applyRestorationPatch(trimmed.view(), patch);
+        if (restored.size() == trimmed.size()) return RT_ERROR_VALIDATION_FAILED;
+
+        std::ofstream out(restored_file, std::ios::binary | std::ios::trunc);
+        out.write(restored.data(), static_cast<std::streamsize>(restored.size()));
+        return out.good() ? RT_SUCCESS : RT_ERROR_WRITE_FAILED;
+    } catch (...) {
+        return RT_ERROR_FILE_NOT_FOUND;
+    }
+}
+
+void rt_free(void* ptr) {
+    std::free(ptr);
+}
+
+} // extern "C"
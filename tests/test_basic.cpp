@@ -3,12 +3,55 @@
 #include "../include/SafetyValidator.hpp"
 #include "ValidationResult.hpp"   // ou SafetyValidator completa, se ela definir
 #include "TrimOptions.hpp"
+#include "Localization.hpp"
+#include "JsonWriter.hpp"
+#include "NdjsonWriter.hpp"
+#include "N64ByteOrder.hpp"
+#include "SnesHeader.hpp"
+#include "TrimEngine.hpp"
+#include "ChecksumVerifier.hpp"
+#include "DatIntegration.hpp"
+#include "DatCatalog.hpp"
+#include "Deduplicator.hpp"
+#include "ChunkIndex.hpp"
 #include <cassert>
 #include <iostream>
 #include <string>
 #include <cstring>  // Para memcpy
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
 #include <catch_amalgamated.hpp>
 
+#ifndef _WIN32
+    #include <poll.h>
+    #include <unistd.h>
+#endif
+
+namespace {
+    // Logo Nintendo que o detector procura no header de GB/GBC
+    const uint8_t GB_LOGO[] = {
+        0xCE, 0xED, 0x66, 0x66, 0xCC, 0x0D, 0x00, 0x0B, 0x03, 0x73, 0x00, 0x83,
+        0x00, 0x0C, 0x00, 0x0D, 0x00, 0x08, 0x11, 0x1F, 0x88, 0x89, 0x00, 0x0E,
+        0xDC, 0xCC, 0x6E, 0xE6, 0xDD, 0xDD, 0xD9, 0x99, 0xBB, 0xBB, 0x67, 0x63,
+        0x6E, 0x0E, 0xEC, 0xCC, 0xDD, 0xDC, 0x99, 0x9F, 0xBB, 0xB9, 0x33, 0x3E
+    };
+
+    // Header mínimo de GB em rom: logo em 0x104 e flag CGB zerada
+    void writeGbHeader(std::string& rom) {
+        std::copy(std::begin(GB_LOGO), std::end(GB_LOGO), rom.begin() + 0x104);
+        rom[0x143] = '\0';
+    }
+
+    // Diretório temporário vazio, exclusivo do teste
+    std::filesystem::path freshTempDir(const std::string& name) {
+        auto dir = std::filesystem::temp_directory_path() / ("romtrimmer_" + name);
+        std::filesystem::remove_all(dir);
+        std::filesystem::create_directories(dir);
+        return dir;
+    }
+}
+
 void testRomDetector() {
     RomDetector detector;
     
@@ -101,4 +144,645 @@ void testEndToEnd() {
            analysis.trimPoint == actualData + (4 - actualData % 4));
     
     std::cout << "✓ End-to-end test passed" << std::endl;
-}
\ No newline at end of file
+}
+
+TEST_CASE("TR resolve chaves em tempo de compilação com fallback para inglês") {
+    auto& loc = LocalizationManager::instance();
+
+    loc.setLanguage("pt");
+    REQUIRE(TR("PROCESSING") == "Processando: ");
+    // Chave sem tradução em português cai no inglês
+    REQUIRE(TR("EXTENSIONS_HELP") == "Custom file extensions (comma-separated)");
+    // Busca por nome em tempo de execução
+    REQUIRE(loc.getString("NO_PADDING") == TR("NO_PADDING"));
+    REQUIRE(loc.getString("NOT_A_KEY") == "NOT_A_KEY");
+
+    loc.setLanguage("en");
+    REQUIRE(TR("PROCESSING") == "Processing: ");
+}
+
+TEST_CASE("JsonWriter gera registro NDJSON com escape") {
+    JsonWriter json;
+    json.field("path", "roms/\"a\"\tb.gba")
+        .field("size", size_t(4096))
+        .field("ok", true)
+        .field("ratio", 0.25)
+        .stringArray("warnings", std::vector<std::string>{"x\ny"});
+
+    REQUIRE(json.finish() ==
+            "{\"path\":\"roms/\\\"a\\\"\\tb.gba\",\"size\":4096,\"ok\":true,"
+            "\"ratio\":0.25,\"warnings\":[\"x\\ny\"]}");
+
+    // UTF-8 válido passa; byte solto, overlong e sequência truncada viram U+FFFD
+    REQUIRE(JsonWriter().field("p", "jogo\xC3\xA9\xE2\x82\xAC.gba").finish() ==
+            "{\"p\":\"jogo\xC3\xA9\xE2\x82\xAC.gba\"}");
+    REQUIRE(JsonWriter().field("p", "a\xFF" "b\xC0\xAF" "c\xE2\x82").finish() ==
+            "{\"p\":\"a\\ufffdb\\ufffd\\ufffdc\\ufffd\\ufffd\"}");
+}
+
+#ifndef _WIN32
+TEST_CASE("NdjsonWriter entrega o registro no prazo sem esperar o próximo") {
+    int fds[2];
+    REQUIRE(::pipe(fds) == 0);
+    {
+        NdjsonWriter writer(fds[1], std::chrono::milliseconds(20));
+        writer.write("{\"a\":1}");
+
+        // Nenhum write() depois deste: só a thread de descarga pode mandá-lo
+        pollfd pfd{fds[0], POLLIN, 0};
+        REQUIRE(::poll(&pfd, 1, 2000) == 1);
+        char line[16] = {};
+        REQUIRE(::read(fds[0], line, sizeof(line)) == 8);
+        REQUIRE(std::string(line) == "{\"a\":1}\n");
+
+        writer.write("{\"b\":2}");
+    }
+    // O destrutor descarrega o que ficou
+    char line[16] = {};
+    REQUIRE(::read(fds[0], line, sizeof(line)) == 8);
+    REQUIRE(std::string(line) == "{\"b\":2}\n");
+    ::close(fds[0]);
+    ::close(fds[1]);
+}
+#endif
+
+TEST_CASE("NDS usa o tamanho declarado no header e confere a cauda") {
+    auto putU32 = [](std::string& rom, size_t offset, uint32_t value) {
+        for (int i = 0; i < 4; ++i) rom[offset + i] = static_cast<char>(value >> (8 * i));
+    };
+
+    const size_t usedSize = 0x40000;
+    std::string rom(1024 * 1024, '\xFF');
+    std::fill(rom.begin(), rom.begin() + usedSize, '\x11');
+    std::fill(rom.begin(), rom.begin() + 0x200, '\0');
+    putU32(rom, 0x20, 0x4000);    // ARM9
+    putU32(rom, 0x2C, 0x1000);
+    putU32(rom, 0x68, 0);         // sem ícone
+    putU32(rom, 0x80, usedSize);
+    putU32(rom, 0x84, 0x4000);
+    rom.replace(usedSize, 2, "ac"); // assinatura do download play
+    std::fill(rom.begin() + usedSize + 2, rom.begin() + usedSize + 0x88, '\x22');
+
+    PaddingAnalyzer analyzer;
+    PaddingAnalysis analysis = analyzer.analyze(rom, 0xFF, RomType::NDS);
+    REQUIRE(analysis.hasPadding);
+    REQUIRE(analysis.patternType == "header");
+    REQUIRE(analysis.trimPoint == usedSize + 0x88);
+
+    // Dado escondido depois do tamanho declarado: volta para a varredura
+    rom[rom.size() - 100] = '\x33';
+    analysis = analyzer.analyze(rom, 0xFF, RomType::NDS);
+    REQUIRE(analysis.patternType != "header");
+    REQUIRE(analysis.trimPoint == rom.size() - 96);
+}
+
+TEST_CASE("Detector reconhece os consoles só pelo header") {
+    RomDetector detector;
+    const size_t size = 2 * 1024 * 1024;
+
+    std::string gb(size, '\0');
+    writeGbHeader(gb);
+    REQUIRE(detector.detect(gb) == RomType::GB);
+    gb[0x143] = '\x80';    // flag CGB
+    REQUIRE(detector.detect(gb) == RomType::GBC);
+
+    std::string nes(size, '\0');
+    nes.replace(0, 4, "NES\x1A", 4);
+    REQUIRE(detector.detect(nes) == RomType::NES);
+
+    std::string n64(size, '\0');
+    n64.replace(0, 4, "\x37\x80\x40\x12", 4);    // .v64
+    REQUIRE(detector.detect(n64) == RomType::N64);
+
+    std::string md(size, '\0');
+    md.replace(0x100, 15, "SEGA MEGA DRIVE");
+    REQUIRE(detector.detect(md) == RomType::MEGADRIVE);
+
+    // HiROM com header de copiadora: complemento ^ checksum = 0xFFFF
+    std::string snes(size + 0x200, '\0');
+    const size_t base = 0x200 + 0xFFC0;
+    snes[base + 0x15] = '\x21';
+    snes.replace(base + 0x1C, 4, "\x34\x12\xCB\xED", 4);
+    REQUIRE(detector.detect(snes) == RomType::SNES);
+    REQUIRE(detector.detectHeader(snes.substr(0, RomDetector::HEADER_WINDOW),
+                                  snes.size()) == RomType::SNES);
+}
+
+TEST_CASE("N64 .v64 e .n64 normalizam para .z64") {
+    std::string z64(1000 * 4 + 3, '\0');
+    for (size_t i = 0; i < z64.size(); ++i) z64[i] = static_cast<char>(i * 7);
+    z64.replace(0, 4, "\x80\x37\x12\x40", 4);
+
+    std::string v64 = z64;
+    std::string n64 = z64;
+    for (size_t i = 0; i + 2 <= z64.size(); i += 2) {
+        std::swap(v64[i], v64[i + 1]);
+    }
+    for (size_t i = 0; i + 4 <= z64.size(); i += 4) {
+        std::reverse(n64.begin() + i, n64.begin() + i + 4);
+    }
+    REQUIRE(detectN64ByteOrder(v64) == N64ByteOrder::V64);
+    REQUIRE(detectN64ByteOrder(n64) == N64ByteOrder::N64);
+
+    std::string out(z64.size(), '\0');
+    normalizeN64(n64.data(), &out[0], n64.size(), N64ByteOrder::N64);
+    REQUIRE(out == z64);
+
+    // In-place; o byte solto do fim (tamanho ímpar) fica como está
+    normalizeN64(v64.data(), &v64[0], v64.size(), N64ByteOrder::V64);
+    REQUIRE(v64 == z64);
+}
+
+TEST_CASE("SNES com header de copiadora é analisado pelo payload") {
+    const size_t dataEnd = 0xC0000;
+    std::string rom(0x200 + 0x100000, '\xFF');
+    for (size_t i = 0x200; i < 0x200 + dataEnd; ++i) rom[i] = static_cast<char>(i * 13 + 1);
+
+    // LoROM: header interno em 0x7FC0 do payload
+    const size_t base = 0x200 + 0x7FC0;
+    rom[base + 0x15] = '\x20';
+    rom.replace(base + 0x1C, 4, "\x34\x12\xCB\xED", 4);
+
+    SnesLayout layout = parseSnesLayout(rom, rom.size());
+    REQUIRE(layout.valid);
+    REQUIRE(layout.copierHeader == 0x200);
+    REQUIRE_FALSE(layout.hiRom);
+
+    TrimOptions options;
+    options.paddingByte = 0xFF;
+    TrimEngine engine(options);
+    TrimReport report = engine.analyzeData(rom);
+    REQUIRE(report.romType == RomType::SNES);
+    REQUIRE(report.headerSize == 0x200);
+    REQUIRE(report.trimPoint == 0x200 + dataEnd);
+}
+
+TEST_CASE("Perfil da cauda classifica o que vem antes do padding") {
+    PaddingAnalyzer analyzer;
+    std::string data;
+    for (int i = 0; i < 8192; ++i) data.push_back(static_cast<char>(i * 31 + 7));
+    std::string padding(64 * 1024, '\xFF');
+
+    PaddingAnalysis analysis = analyzer.analyze(data + padding, 0xFF);
+    REQUIRE(analysis.hasPadding);
+    REQUIRE(analysis.patternType == "continuous");
+    REQUIRE(analysis.trimPoint == data.size());
+
+    // FF/00 alternados colados no padding: não corta
+    std::string alternating;
+    for (int i = 0; i < 256; ++i) alternating += "\xFF";
+    for (int i = 0; i < 128; ++i) alternating += std::string("\xFF\x00", 2);
+    analysis = analyzer.analyze(data + alternating.substr(256) + padding, 0xFF);
+    REQUIRE_FALSE(analysis.hasPadding);
+    REQUIRE(analysis.patternType == "alternating");
+
+    // Zeros e depois 0xFF: padding misto, corta só o 0xFF
+    std::string zeros(4096, '\0');
+    analysis = analyzer.analyze(data + zeros + padding, 0xFF);
+    REQUIRE(analysis.patternType == "mixed");
+    REQUIRE(analysis.trimPoint == data.size() + zeros.size());
+    REQUIRE(analyzer.hasMixedPadding(data + zeros + padding));
+
+    // Padrão curto repetido: corta, mas com menos confiança
+    std::string filler;
+    for (int i = 0; i < 64; ++i) filler += "\xDE\xAD\xBE\xEF";
+    PaddingAnalysis repeated = analyzer.analyze(data + filler + padding, 0xFF);
+    REQUIRE(repeated.patternType == "repeating");
+    REQUIRE(repeated.confidence < analyzer.analyze(data + padding, 0xFF).confidence);
+}
+
+TEST_CASE("Padding auto escolhe o byte da sequência final") {
+    PaddingAnalyzer analyzer;
+    std::string data;
+    for (int i = 0; i < 8192; ++i) data.push_back(static_cast<char>(i * 31 + 7));
+
+    PaddingAnalysis analysis = analyzer.analyzeAuto(data + std::string(16384, '\xCD'), RomType::GB);
+    REQUIRE(analysis.hasPadding);
+    REQUIRE(analysis.paddingByte == 0xCD);
+    REQUIRE(analysis.trimPoint == data.size());
+
+    // Valor incomum com sequência curta: são dados
+    analysis = analyzer.analyzeAuto(data + std::string(64, '\xAA'), RomType::GB);
+    REQUIRE_FALSE(analysis.hasPadding);
+
+    // GBA: zeros no fim são dados em auto, por mais longos que sejam; 0xFF é padding
+    REQUIRE_FALSE(analyzer.analyzeAuto(data + std::string(512, '\0'), RomType::GBA).hasPadding);
+    REQUIRE_FALSE(analyzer.analyzeAuto(data + std::string(1 << 20, '\0'), RomType::GBA).hasPadding);
+    REQUIRE(analyzer.autoDetectPadding(data + std::string(1 << 20, '\0'), RomType::GBA) == 0xFF);
+    REQUIRE(analyzer.analyzeAuto(data + std::string(512, '\xFF'), RomType::GBA).hasPadding);
+
+    // Pedido explícito ainda corta os zeros do GBA; fora do GBA, 0x00 vale em auto
+    REQUIRE(analyzer.analyze(data + std::string(1 << 20, '\0'), 0x00, RomType::GBA).hasPadding);
+    REQUIRE(analyzer.analyzeAuto(data + std::string(1 << 20, '\0'), RomType::NDS).paddingByte == 0x00);
+}
+
+TEST_CASE("ChecksumVerifier bate com os vetores conhecidos") {
+    ChecksumVerifier verifier;
+    using Type = ChecksumVerifier::ChecksumType;
+    REQUIRE(verifier.calculate("123456789", Type::CRC32) == "cbf43926");
+    REQUIRE(verifier.calculate("abc", Type::MD5) == "900150983cd24fb0d6963f7d28e17f72");
+    REQUIRE(verifier.calculate("abc", Type::SHA1) == "a9993e364706816aba3e25717850c26c9cd0d89d");
+    REQUIRE(verifier.verify("abc", "BA7816BF8F01CFEA414140DE5DAE2223B00361A396177A9CB410FF61F20015AD",
+                            Type::SHA256).valid);
+    REQUIRE(verifier.verifyAgainstDatabase("Jogo [CBF43926].gba", "123456789"));
+
+    // Tamanhos que passam pelo kernel vetorial e pela cauda, inteiros ou em blocos
+    std::string data;
+    for (int i = 0; i < 4099; ++i) data.push_back(static_cast<char>(i * 131 + (i >> 5)));
+    for (size_t size : {size_t(63), size_t(64), size_t(80), size_t(1000), data.size()}) {
+        uint32_t expected = 0xFFFFFFFFu;
+        for (size_t i = 0; i < size; ++i) {
+            expected ^= static_cast<uint8_t>(data[i]);
+            for (int k = 0; k < 8; ++k) expected = (expected >> 1) ^ (0xEDB88320u & (0u - (expected & 1)));
+        }
+        expected = ~expected;
+
+        REQUIRE(ChecksumVerifier::crc32Update(0, data.data(), size) == expected);
+        uint32_t chunked = ChecksumVerifier::crc32Update(0, data.data(), size / 3);
+        chunked = ChecksumVerifier::crc32Update(chunked, data.data() + size / 3, size - size / 3);
+        REQUIRE(chunked == expected);
+    }
+}
+
+TEST_CASE("ROM aparada confere com o DAT original sem reler o padding") {
+    std::string data;
+    for (int i = 0; i < 70000; ++i) data.push_back(static_cast<char>(i * 7 + (i >> 9)));
+    std::string full = data + std::string(200000, '\xCD');
+
+    ChecksumVerifier verifier;
+    using Type = ChecksumVerifier::ChecksumType;
+    RomEntry entry;
+    entry.size = std::to_string(full.size());
+    entry.crc32 = verifier.calculate(full, Type::CRC32);
+    entry.md5 = verifier.calculate(full, Type::MD5);
+    entry.sha1 = verifier.calculate(full, Type::SHA1);
+
+    REQUIRE(ChecksumVerifier::crc32Run(0xCD, 200000) ==
+            ChecksumVerifier::crc32Update(0, full.data() + data.size(), 200000));
+
+    auto path = std::filesystem::temp_directory_path() / "romtrimmer_verify_trimmed.bin";
+    std::ofstream(path, std::ios::binary).write(data.data(), static_cast<std::streamsize>(data.size()));
+
+    uint8_t paddingByte = 0;
+    REQUIRE(DatIntegrator::verifyTrimmedRom(path.string(), entry, &paddingByte));
+    REQUIRE(paddingByte == 0xCD);
+
+    // Sem CRC no DAT só 0xFF/0x00 são tentados
+    entry.crc32.clear();
+    REQUIRE_FALSE(DatIntegrator::verifyTrimmedRom(path.string(), entry));
+    std::filesystem::remove(path);
+}
+
+TEST_CASE("Verificação de diretório separa inteiras, aparadas e modificadas") {
+    namespace fs = std::filesystem;
+    std::string data;
+    for (int i = 0; i < 70000; ++i) data.push_back(static_cast<char>(i * 13 + (i >> 7)));
+    std::string full = data + std::string(60000, '\xFF');
+
+    ChecksumVerifier verifier;
+    using Type = ChecksumVerifier::ChecksumType;
+    std::vector<RomEntry> entries;
+    for (const char* name : {"inteira.bin", "aparada.bin", "mexida.bin"}) {
+        RomEntry entry;
+        entry.name = name;
+        entry.size = std::to_string(full.size());
+        entry.crc32 = verifier.calculate(full, Type::CRC32);
+        entry.md5 = verifier.calculate(full, Type::MD5);
+        entry.sha1 = verifier.calculate(full, Type::SHA1);
+        entries.push_back(entry);
+    }
+
+    fs::path dir = freshTempDir("verify_dir");
+    std::string changed = data;
+    changed[100] ^= 0x5A;
+    std::ofstream(dir / "inteira.bin", std::ios::binary) << full;
+    std::ofstream(dir / "aparada.bin", std::ios::binary) << data;
+    std::ofstream(dir / "mexida.bin", std::ios::binary) << changed;
+    std::ofstream(dir / "extra.bin", std::ios::binary) << data;
+
+    auto results = DatIntegrator::verifyDirectoryAgainstDat(dir.string(), entries, false);
+    REQUIRE(results.at("inteira.bin").status == "ok");
+    REQUIRE(results.at("aparada.bin").status == "trimmed");
+    REQUIRE(results.at("mexida.bin").status == "modified");
+    REQUIRE(results.at("extra.bin").status == "missing");
+    fs::remove_all(dir);
+}
+
+TEST_CASE("DatCatalog guarda o DAT em colunas e devolve RomEntry igual") {
+    RomEntry a;
+    a.name = "Jogo A";
+    a.size = "4194304";
+    a.crc32 = "CBF43926";
+    a.sha1 = "A9993E364706816ABA3E25717850C26C9CD0D89D";
+    RomEntry b;
+    b.name = "jogo b";
+    b.md5 = "900150983cd24fb0d6963f7d28e17f72";
+    b.status = "modified";
+
+    DatCatalog catalog = DatCatalog::fromEntries({a, b});
+    REQUIRE(catalog.size() == 2);
+    REQUIRE(catalog.romSize(0) == 4194304);
+    REQUIRE(catalog.crc32(0) == 0xCBF43926u);
+    REQUIRE_FALSE(catalog.hasSize(1));
+    REQUIRE(catalog.status(1) == RomStatus::MODIFIED);
+
+    RomEntry back = catalog.entry(0);
+    REQUIRE(back.crc32 == "cbf43926");
+    REQUIRE(back.sha1 == "a9993e364706816aba3e25717850c26c9cd0d89d");
+    REQUIRE(back.md5.empty());
+
+    REQUIRE(catalog.findByName("JOGO B") == 1);
+    REQUIRE(catalog.findByCrc32(0xCBF43926u) == 0);
+    REQUIRE(catalog.findByName("Jogo C") == DatCatalog::npos);
+
+    ChecksumVerifier::Digests digests;
+    digests.size = 4194304;
+    digests.crc32 = 0xCBF43926u;
+    digests.sha1 = "a9993e364706816aba3e25717850c26c9cd0d89d";
+    REQUIRE(catalog.matches(0, digests));
+    digests.size = 1;
+    REQUIRE_FALSE(catalog.matches(0, digests));
+}
+
+TEST_CASE("Diff de DATs casa por nome e acha renomeados pelo conteúdo") {
+    auto entry = [](const std::string& name, const std::string& crc, const std::string& size) {
+        RomEntry e;
+        e.name = name;
+        e.crc32 = crc;
+        e.size = size;
+        return e;
+    };
+    DatCatalog first = DatCatalog::fromEntries({entry("Alfa", "00000001", "100"),
+                                                entry("Beta", "00000002", "200"),
+                                                entry("Gama", "00000003", "300")});
+    DatCatalog second = DatCatalog::fromEntries({entry("alfa", "00000001", "100"),
+                                                 entry("Beta", "0000000F", "200"),
+                                                 entry("Gama (Rev 1)", "00000003", "300"),
+                                                 entry("Delta", "00000004", "400")});
+
+    auto differences = DatCatalog::diff(first, second);
+    REQUIRE(differences.size() == 3);
+    auto find = [&](uint8_t change) {
+        return std::find_if(differences.begin(), differences.end(),
+                            [change](const DatDifference& d) { return d.changes & change; });
+    };
+    REQUIRE(find(DAT_CRC32_CHANGED)->first == 1);
+    REQUIRE(find(DAT_RENAMED)->second == 2);
+    REQUIRE(find(DAT_ONLY_IN_SECOND)->second == 3);
+
+    // Sem detectar renomeados, Gama vira saída + entrada
+    REQUIRE(DatCatalog::diff(first, second, false).size() == 4);
+}
+
+TEST_CASE("Dedup agrupa só arquivos de conteúdo idêntico") {
+    auto dir = freshTempDir("dedup");
+
+    // a/b iguais; c só difere no último byte (cai no filtro início/fim)
+    std::string data(300 * 1024, '\x5A');
+    std::string other = data;
+    other.back() = '\x5B';
+    std::vector<std::filesystem::path> files = {dir / "a.gba", dir / "b.gba", dir / "c.gba"};
+    std::ofstream(files[0], std::ios::binary) << data;
+    std::ofstream(files[1], std::ios::binary) << data;
+    std::ofstream(files[2], std::ios::binary) << other;
+
+    DedupOptions options;
+    options.dryRun = true;
+    options.threads = 2;
+    DedupReport report = Deduplicator(options).run(files);
+
+    REQUIRE(report.sizeCandidates == 3);
+    REQUIRE(report.hashCandidates == 2);
+    REQUIRE(report.groups == 1);
+    REQUIRE(report.actions.size() == 1);
+    REQUIRE(report.actions[0].original == files[0]);
+    REQUIRE(report.actions[0].duplicate == files[1]);
+    REQUIRE(report.reclaimedBytes == data.size());
+
+    // Duplicata mudou depois do hash: nem reflink nem hard link a tocam
+    auto stampA = Deduplicator::stamp(files[0]);
+    auto stampB = Deduplicator::stamp(files[1]);
+    std::ofstream(files[1], std::ios::binary | std::ios::trunc) << other;
+    std::filesystem::last_write_time(files[1], std::filesystem::last_write_time(files[1]) +
+                                                   std::chrono::seconds(2));
+    REQUIRE_THROWS(Deduplicator::replaceWithClone(files[0], files[1], true, stampA, stampB));
+    std::ifstream check(files[1], std::ios::binary);
+    REQUIRE(std::string(std::istreambuf_iterator<char>(check), {}) == other);
+    REQUIRE(std::filesystem::hard_link_count(files[1]) == 1);
+    std::filesystem::remove_all(dir);
+}
+
+TEST_CASE("Chunks FastCDC realinham depois de uma inserção") {
+    REQUIRE(ChunkIndex::setName("roms/Jogo (USA).gba") == "Jogo");
+    REQUIRE(ChunkIndex::setName("roms/Jogo (Europe) (Rev 1).gba") == "Jogo");
+    REQUIRE(ChunkIndex::setName("(Beta).gba") == "(Beta)");
+
+    std::vector<uint8_t> data(256 * 1024);
+    uint32_t state = 12345;
+    for (auto& byte : data) {
+        state = state * 1103515245u + 12345u;
+        byte = static_cast<uint8_t>(state >> 16);
+    }
+    std::vector<uint8_t> shifted = data;
+    shifted.insert(shifted.begin() + 1000, 37, 0xAA);
+
+    auto cuts = [](const ChunkIndex& index, const std::vector<uint8_t>& bytes, size_t base) {
+        std::vector<size_t> ends;
+        for (size_t offset = 0; offset < bytes.size();) {
+            offset += index.cutPoint(bytes.data() + offset, bytes.size() - offset);
+            ends.push_back(offset - base);
+        }
+        return ends;
+    };
+
+    ChunkIndex index;
+    std::vector<size_t> original = cuts(index, data, 0);
+    std::vector<size_t> moved = cuts(index, shifted, 37);
+    REQUIRE(original.size() > 8);
+
+    // A partir do segundo corte as fronteiras são as mesmas, deslocadas
+    size_t shared = 0;
+    for (size_t end : moved) {
+        shared += std::count(original.begin(), original.end(), end);
+    }
+    REQUIRE(shared >= original.size() - 2);
+}
+
+TEST_CASE("Pack de chunks remonta os arquivos relativos à entrada") {
+    namespace fs = std::filesystem;
+    fs::path base = freshTempDir("pack");
+    fs::create_directories(base / "work");
+    fs::create_directories(base / "roms" / "sub");
+
+    std::string a(96 * 1024, '\0');
+    uint32_t state = 777;
+    for (auto& c : a) {
+        state = state * 1103515245u + 12345u;
+        c = static_cast<char>(state >> 16);
+    }
+    std::string b = a;
+    b.insert(5000, "revisao");
+    std::ofstream(base / "roms" / "Jogo (USA).gba", std::ios::binary) << a;
+    std::ofstream(base / "roms" / "sub" / "Jogo (Europe).gba", std::ios::binary) << b;
+
+    // Entrada com ".." (como -p ../roms): os nomes não podem levar o ".."
+    fs::path root = base / "work" / ".." / "roms";
+    std::vector<fs::path> files = {root / "Jogo (USA).gba", root / "sub" / "Jogo (Europe).gba"};
+
+    ChunkOptions options;
+    options.averageSize = 4096;
+    ChunkIndex index(options);
+    ChunkReport report = index.analyze(files);
+    REQUIRE(report.library.uniqueBytes < report.library.bytes);
+
+    index.writePack(base / "lib.rtpack", {root});
+    REQUIRE(ChunkIndex::unpack(base / "lib.rtpack", base / "out") == 2);
+
+    auto slurp = [](const fs::path& path) {
+        std::ifstream in(path, std::ios::binary);
+        return std::string(std::istreambuf_iterator<char>(in), {});
+    };
+    REQUIRE(slurp(base / "out" / "Jogo (USA).gba") == a);
+    REQUIRE(slurp(base / "out" / "sub" / "Jogo (Europe).gba") == b);
+
+    // Sem raízes: relativo ao diretório comum aos arquivos
+    index.writePack(base / "lib2.rtpack");
+    REQUIRE(ChunkIndex::unpack(base / "lib2.rtpack", base / "out2") == 2);
+    REQUIRE(slurp(base / "out2" / "sub" / "Jogo (Europe).gba") == b);
+
+    // Saída existente: nada é escrito sem overwrite
+    std::ofstream(base / "out2" / "Jogo (USA).gba", std::ios::binary) << "local";
+    REQUIRE_THROWS(ChunkIndex::unpack(base / "lib2.rtpack", base / "out2"));
+    REQUIRE(slurp(base / "out2" / "Jogo (USA).gba") == "local");
+    REQUIRE(ChunkIndex::unpack(base / "lib2.rtpack", base / "out2", true) == 2);
+    REQUIRE(slurp(base / "out2" / "Jogo (USA).gba") == a);
+
+    // Arquivo alterado com o mesmo tamanho: o pack não é gerado
+    std::string changed = a;
+    changed[70000] = static_cast<char>(~changed[70000]);
+    std::ofstream(root / "Jogo (USA).gba", std::ios::binary) << changed;
+    REQUIRE_THROWS(index.writePack(base / "lib3.rtpack", {root}));
+    REQUIRE_FALSE(fs::exists(base / "lib3.rtpack"));
+    REQUIRE_FALSE(fs::exists(base / "lib3.rtpack.tmp"));
+
+    fs::remove_all(base);
+}
+
+TEST_CASE("Punch hole mantém tamanho e conteúdo do padding 0x00") {
+    auto path = std::filesystem::temp_directory_path() / "romtrimmer_sparse.bin";
+    std::string data(64 * 1024, '\x42');
+    data.resize(1024 * 1024, '\0');
+    std::ofstream(path, std::ios::binary) << data;
+
+    try {
+        punchFileHole(path, 64 * 1024, data.size() - 64 * 1024);
+    } catch (const std::exception& e) {
+        std::filesystem::remove(path);
+        SKIP(e.what());
+    }
+
+    REQUIRE(std::filesystem::file_size(path) == data.size());
+    MappedFile file(path);
+    REQUIRE(file.view() == data);
+    file.close();
+    std::filesystem::remove(path);
+}
+
+TEST_CASE("processDirectoryWithDat grava o DAT com o que ficou no disco") {
+    auto makeRom = [](uint32_t seed) {
+        std::string rom(512 * 1024, '\xFF');
+        for (size_t i = 0; i < 256 * 1024; ++i) {   // corte num tamanho válido de GB
+            seed = seed * 1103515245u + 12345u;
+            rom[i] = static_cast<char>(seed >> 16);
+        }
+        writeGbHeader(rom);
+        return rom;
+    };
+    std::string romA = makeRom(1);
+    std::string romB = makeRom(2);
+
+    ChecksumVerifier verifier;
+    using Type = ChecksumVerifier::ChecksumType;
+    auto datLine = [&](const std::string& name, const std::string& rom) {
+        return "<game name=\"" + name + "\">\n<rom name=\"" + name + "\" size=\"" +
+               std::to_string(rom.size()) + "\" crc=\"" + verifier.calculate(rom, Type::CRC32) +
+               "\" sha1=\"" + verifier.calculate(rom, Type::SHA1) + "\"/>\n</game>\n";
+    };
+
+    auto dir = freshTempDir("fused");
+    std::filesystem::create_directories(dir / "roms");
+    auto datPath = (dir / "orig.dat").string();
+    std::ofstream(datPath) << "<datafile>\n" << datLine("a.gb", romA) << datLine("b.gb", romB)
+                           << datLine("c.gb", romA + "x") << "</datafile>\n";
+
+    // c.gb tem o nome de uma entrada mas o conteúdo de b.gb: cai no SHA1
+    auto writeRoms = [&]() {
+        std::ofstream(dir / "roms" / "a.gb", std::ios::binary) << romA;
+        std::ofstream(dir / "roms" / "c.gb", std::ios::binary) << romB;
+    };
+    auto outDat = (dir / "out.dat").string();
+
+    writeRoms();
+    auto preview = DatIntegrator::processDirectoryWithDat((dir / "roms").string(), datPath,
+                                                          false, "", outDat);
+    REQUIRE(preview.size() == 2);
+    REQUIRE(preview["a.gb"]["status"] == "would_trim");
+    REQUIRE(preview["b.gb"]["status"] == "would_trim");
+    // Nada gravado: o DAT repete os checksums originais
+    auto unchanged = DatCatalog::load(outDat);
+    REQUIRE(unchanged.size() == 2);
+    for (size_t i = 0; i < unchanged.size(); ++i) {
+        REQUIRE(unchanged.romSize(i) == romA.size());
+    }
+
+    auto trimmed = DatIntegrator::processDirectoryWithDat((dir / "roms").string(), datPath,
+                                                          true, "", outDat);
+    REQUIRE(trimmed["a.gb"]["status"] == "trimmed");
+    REQUIRE(trimmed["b.gb"]["status"] == "trimmed");
+    auto trimmedA = std::filesystem::file_size(dir / "roms" / "a.gb");
+    REQUIRE(trimmedA < romA.size());
+
+    auto emitted = DatCatalog::load(outDat);
+    emitted.buildIndex();
+    size_t a = emitted.findByName("a.gb");
+    REQUIRE(a != DatCatalog::npos);
+    REQUIRE(emitted.romSize(a) == trimmedA);
+    REQUIRE(emitted.crc32(a) == ChecksumVerifier::crc32Update(0, romA.data(), trimmedA));
+    std::filesystem::remove_all(dir);
+}
+
+TEST_CASE("Rename pelo DAT não sobrescreve e reconhece só as próprias cópias") {
+    auto dir = freshTempDir("rename");
+
+    std::string rom(8192, '\0');
+    for (size_t i = 0; i < rom.size(); ++i) rom[i] = static_cast<char>(i * 31 + (i >> 7));
+    auto write = [&dir](const std::string& name, const std::string& data) {
+        std::ofstream(dir / name, std::ios::binary) << data;
+    };
+    // "Tetris.gb" já ocupado por outro conteúdo; dois dumps do mesmo jogo,
+    // um deles com nome de outra revisão
+    write("Tetris.gb", "outro conteudo");
+    write("dump.gb", rom);
+    write("Tetris (World) (Rev 1).gb", rom);
+
+    ChecksumVerifier verifier;
+    RomEntry entry;
+    entry.name = "Tetris.gb";
+    entry.size = std::to_string(rom.size());
+    entry.crc32 = verifier.calculate(rom, ChecksumVerifier::ChecksumType::CRC32);
+    entry.sha1 = verifier.calculate(rom, ChecksumVerifier::ChecksumType::SHA1);
+
+    REQUIRE(DatIntegrator::renameFilesToDatNames(dir.string(), {entry}));
+
+    std::vector<std::string> names;
+    for (const auto& item : std::filesystem::directory_iterator(dir)) {
+        names.push_back(item.path().filename().string());
+    }
+    std::sort(names.begin(), names.end());
+    REQUIRE(names == std::vector<std::string>{"Tetris (2).gb", "Tetris (3).gb", "Tetris.gb"});
+    REQUIRE(std::filesystem::file_size(dir / "Tetris.gb") == 14);
+
+    // Segunda rodada: as cópias "(n)" já estão nomeadas
+    REQUIRE_FALSE(DatIntegrator::renameFilesToDatNames(dir.string(), {entry}));
+    std::filesystem::remove_all(dir);
+}